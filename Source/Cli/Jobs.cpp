@@ -0,0 +1,1075 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Jobs.hpp"
+#include "ResultWriter.hpp"
+#include <Core/Enum/Buttons.hpp>
+#include <Core/Enum/DSType.hpp>
+#include <Core/Enum/Encounter.hpp>
+#include <Core/Enum/Game.hpp>
+#include <Core/Enum/Language.hpp>
+#include <Core/Enum/Lead.hpp>
+#include <Core/Enum/Method.hpp>
+#include <Core/Gen3/EncounterArea3.hpp>
+#include <Core/Gen3/Encounters3.hpp>
+#include <Core/Gen3/Generators/StaticGenerator3.hpp>
+#include <Core/Gen3/Generators/WildGenerator3.hpp>
+#include <Core/Gen3/Profile3.hpp>
+#include <Core/Gen3/Searchers/ChannelSeedSearcher.hpp>
+#include <Core/Gen3/Searchers/ColoSeedSearcher.hpp>
+#include <Core/Gen3/Searchers/GalesSeedSearcher.hpp>
+#include <Core/Gen3/Searchers/StaticSearcher3.hpp>
+#include <Core/Gen3/Searchers/WildSearcher3.hpp>
+#include <Core/Gen3/StaticTemplate3.hpp>
+#include <Core/Gen4/Encounters4.hpp>
+#include <Core/Gen4/Generators/StaticGenerator4.hpp>
+#include <Core/Gen4/Profile4.hpp>
+#include <Core/Gen4/Searchers/EventSearcher4.hpp>
+#include <Core/Gen4/Searchers/IDSearcher4.hpp>
+#include <Core/Gen4/Searchers/StaticSearcher4.hpp>
+#include <Core/Gen4/States/IDState4.hpp>
+#include <Core/Gen4/States/State4.hpp>
+#include <Core/Gen4/StaticTemplate4.hpp>
+#include <Core/Gen5/Generators/EventGenerator5.hpp>
+#include <Core/Gen5/PGF.hpp>
+#include <Core/Gen5/Profile5.hpp>
+#include <Core/Gen5/Searchers/Searcher5.hpp>
+#include <Core/Gen5/States/SearcherKey5.hpp>
+#include <Core/Gen5/States/SearcherState5.hpp>
+#include <Core/Gen5/States/State5.hpp>
+#include <Core/Gen8/Encounters8.hpp>
+#include <Core/Gen8/Generators/StaticGenerator8.hpp>
+#include <Core/Gen8/Profile8.hpp>
+#include <Core/Gen8/States/State8.hpp>
+#include <Core/Gen8/StaticTemplate8.hpp>
+#include <Core/Parents/Filters/IDFilter.hpp>
+#include <Core/Parents/Filters/StateFilter.hpp>
+#include <Core/Parents/Searchers/ResultExporter.hpp>
+#include <Core/Parents/Searchers/SearchCheckpoint.hpp>
+#include <Core/Parents/Searchers/SearchTelemetry.hpp>
+#include <Core/Parents/States/State.hpp>
+#include <Core/Parents/States/WildState.hpp>
+#include <Core/Util/DateTime.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using json = nlohmann::json;
+using Row = nlohmann::ordered_json;
+
+struct JobType
+{
+    const char *name;
+    void (*run)(const json &job, int threads, ResultWriter &writer);
+};
+
+constexpr std::pair<const char *, Game> games[] = { { "Ruby", Game::Ruby },
+                                                    { "Sapphire", Game::Sapphire },
+                                                    { "Emerald", Game::Emerald },
+                                                    { "FireRed", Game::FireRed },
+                                                    { "LeafGreen", Game::LeafGreen },
+                                                    { "Gales", Game::Gales },
+                                                    { "Colosseum", Game::Colosseum },
+                                                    { "Diamond", Game::Diamond },
+                                                    { "Pearl", Game::Pearl },
+                                                    { "Platinum", Game::Platinum },
+                                                    { "HeartGold", Game::HeartGold },
+                                                    { "SoulSilver", Game::SoulSilver },
+                                                    { "Black", Game::Black },
+                                                    { "White", Game::White },
+                                                    { "Black2", Game::Black2 },
+                                                    { "White2", Game::White2 },
+                                                    { "BD", Game::BD },
+                                                    { "SP", Game::SP } };
+
+/**
+ * @brief Reads a game version either by name or by its numeric value as stored in the profiles file
+ *
+ * @param j JSON value to read
+ *
+ * @return Game version
+ */
+static Game getGame(const json &j)
+{
+    if (j.is_number())
+    {
+        return static_cast<Game>(j.get<u32>());
+    }
+
+    std::string name = j.get<std::string>();
+    auto it = std::find_if(std::begin(games), std::end(games), [&name](const auto &game) { return name == game.first; });
+    if (it == std::end(games))
+    {
+        throw std::runtime_error("Unknown version: " + name);
+    }
+    return it->second;
+}
+
+/**
+ * @brief Reads IVs from the job, defaulting every stat to \p value
+ *
+ * @param job Job specification
+ * @param key IV key
+ * @param value Default IV
+ *
+ * @return IVs
+ */
+static std::array<u8, 6> getIVs(const json &job, const char *key, u8 value)
+{
+    std::array<u8, 6> ivs;
+    ivs.fill(value);
+    if (job.contains(key))
+    {
+        ivs = job[key].get<std::array<u8, 6>>();
+    }
+    return ivs;
+}
+
+/**
+ * @brief Reads the Gen3 profile from the job
+ *
+ * @param job Job specification
+ *
+ * @return Profile information
+ */
+static Profile3 getProfile3(const json &job)
+{
+    const json &j = job.at("profile");
+    return Profile3(j.value("name", "-"), getGame(j.at("version")), j.value("tid", 0), j.value("sid", 0), j.value("deadBattery", false));
+}
+
+/**
+ * @brief Reads the Gen4 profile from the job
+ *
+ * @param job Job specification
+ *
+ * @return Profile information
+ */
+static Profile4 getProfile4(const json &job)
+{
+    const json &j = job.at("profile");
+    return Profile4(j.value("name", "-"), getGame(j.at("version")), j.value("tid", 0), j.value("sid", 0), j.value("dex", false));
+}
+
+/**
+ * @brief Reads the Gen5 profile from the job. Only the first keypress setting is enabled unless others are given.
+ *
+ * @param job Job specification
+ *
+ * @return Profile information
+ */
+static Profile5 getProfile5(const json &job)
+{
+    const json &j = job.at("profile");
+    std::array<bool, 9> keypresses = { true, false, false, false, false, false, false, false, false };
+    if (j.contains("keypresses"))
+    {
+        keypresses = j["keypresses"].get<std::array<bool, 9>>();
+    }
+
+    return Profile5(j.value("name", "-"), getGame(j.at("version")), j.value("tid", 0), j.value("sid", 0), j.at("mac").get<u64>(),
+                    keypresses, j.at("vcount").get<u8>(), j.at("gxstat").get<u8>(), j.at("vframe").get<u8>(), j.value("skipLR", false),
+                    j.at("timer0Min").get<u16>(), j.at("timer0Max").get<u16>(), j.value("softReset", false), j.value("memoryLink", false),
+                    j.value("shinyCharm", false), static_cast<DSType>(j.value("dsType", 0)), static_cast<Language>(j.value("language", 0)));
+}
+
+/**
+ * @brief Reads the Gen8 profile from the job
+ *
+ * @param job Job specification
+ *
+ * @return Profile information
+ */
+static Profile8 getProfile8(const json &job)
+{
+    const json &j = job.at("profile");
+    return Profile8(j.value("name", "-"), getGame(j.at("version")), j.value("tid", 0), j.value("sid", 0), j.value("dex", false),
+                    j.value("shinyCharm", false), j.value("ovalCharm", false));
+}
+
+/**
+ * @brief Reads a date stored as [year, month, day]
+ *
+ * @param job Job specification
+ * @param key Date key
+ *
+ * @return Date
+ */
+static Date getDate(const json &job, const char *key)
+{
+    auto date = job.at(key).get<std::array<u16, 3>>();
+    return Date(date[0], date[1], date[2]);
+}
+
+/**
+ * @brief Reads the static encounter selected by the category and index of the job
+ *
+ * @tparam Template Static template class
+ * @param job Job specification
+ * @param getStaticEncounters Returns the static encounters of a category and their count
+ * @param categories Number of static encounter categories
+ *
+ * @return Static encounter
+ */
+template <class Template>
+static const Template *getStaticTemplate(const json &job, const Template *(*getStaticEncounters)(int, int *), int categories)
+{
+    int category = job.at("category").get<int>();
+    if (category < 0 || category >= categories)
+    {
+        throw std::runtime_error("Unknown static encounter category: " + std::to_string(category));
+    }
+
+    int size;
+    const Template *templates = getStaticEncounters(category, &size);
+    int index = job.at("index").get<int>();
+    if (index < 0 || index >= size)
+    {
+        throw std::runtime_error("Unknown static encounter index: " + std::to_string(index));
+    }
+    return &templates[index];
+}
+
+/**
+ * @brief Reads the Gen3 wild encounter area selected by the encounter type and location index of the job
+ *
+ * @param job Job specification
+ * @param profile Profile information
+ *
+ * @return Encounter area
+ */
+static EncounterArea3 getEncounterArea3(const json &job, const Profile3 &profile)
+{
+    EncounterSettings3 settings;
+    settings.feebasTile = job.value("feebasTile", false);
+
+    auto areas = Encounters3::getEncounters(static_cast<Encounter>(job.at("encounter").get<u8>()), settings, profile.getVersion());
+    int location = job.at("location").get<int>();
+    if (location < 0 || location >= static_cast<int>(areas.size()))
+    {
+        throw std::runtime_error("Unknown encounter location: " + std::to_string(location));
+    }
+    return areas[location];
+}
+
+/**
+ * @brief Reads the leads of a wild search. A "leads" list searches several leads at once, otherwise the single "lead" is used.
+ *
+ * @param job Job specification
+ *
+ * @return Encounter leads
+ */
+static std::vector<Lead> getLeads(const json &job)
+{
+    if (!job.contains("leads"))
+    {
+        return { static_cast<Lead>(job.value("lead", toInt(Lead::None))) };
+    }
+
+    std::vector<Lead> leads;
+    for (int lead : job.at("leads").get<std::vector<int>>())
+    {
+        leads.emplace_back(static_cast<Lead>(lead));
+    }
+
+    if (leads.empty())
+    {
+        throw std::runtime_error("No leads to search");
+    }
+    return leads;
+}
+
+/**
+ * @brief Reads a list of indices as flags. Every flag is set when the list is missing.
+ *
+ * @tparam size Number of flags
+ * @param j JSON object to read
+ * @param key List key
+ *
+ * @return Flags
+ */
+template <size_t size>
+static std::array<bool, size> getFlags(const json &j, const char *key)
+{
+    std::array<bool, size> flags;
+    flags.fill(!j.contains(key));
+    for (u8 index : j.value(key, std::vector<u8>()))
+    {
+        flags.at(index) = true;
+    }
+    return flags;
+}
+
+/**
+ * @brief Reads the state filter from the job. Natures and hidden powers are lists of indices and default to all of them.
+ *
+ * @param job Job specification
+ *
+ * @return State filter
+ */
+static StateFilter getStateFilter(const json &job)
+{
+    json j = job.value("filter", json::object());
+    return StateFilter(j.value("gender", 255), j.value("ability", 255), j.value("shiny", 255), j.value("skip", false),
+                       getIVs(job, "min", 0), getIVs(job, "max", 31), getFlags<25>(j, "natures"), getFlags<16>(j, "powers"));
+}
+
+/**
+ * @brief Reads the wild state filter from the job. Encounter slots are a list of indices and default to all of them.
+ *
+ * @param job Job specification
+ *
+ * @return Wild state filter
+ */
+static WildStateFilter getWildStateFilter(const json &job)
+{
+    json j = job.value("filter", json::object());
+    return WildStateFilter(j.value("gender", 255), j.value("ability", 255), j.value("shiny", 255), j.value("skip", false),
+                           getIVs(job, "min", 0), getIVs(job, "max", 31), getFlags<25>(j, "natures"), getFlags<16>(j, "powers"),
+                           getFlags<12>(j, "slots"));
+}
+
+/**
+ * @brief Computes an identifier of the job's search settings so checkpoints of a different job are not resumed
+ *
+ * @param job Job specification
+ *
+ * @return Job identifier
+ */
+static u64 getJobKey(const json &job)
+{
+    json settings = job;
+    settings.erase("checkpoint");
+    settings.erase("telemetry");
+    std::string dump = settings.dump();
+    return SearchCheckpoint::hash(dump.data(), dump.size());
+}
+
+/**
+ * @brief Appends the Pokemon information shared by every state to an output row
+ *
+ * @param row Row with the columns specific to the state
+ * @param state State to convert
+ *
+ * @return Output row
+ */
+static Row addState(Row row, const State &state)
+{
+    row["pid"] = state.getPID();
+    row["shiny"] = state.getShiny();
+    row["nature"] = state.getNature();
+    row["ability"] = state.getAbility();
+    row["ivs"] = state.getIVs();
+    row["hiddenPower"] = state.getHiddenPower();
+    row["hiddenPowerStrength"] = state.getHiddenPowerStrength();
+    row["gender"] = state.getGender();
+    row["stats"] = state.getStats();
+    return row;
+}
+
+/**
+ * @brief Converts a generator state to an output row
+ *
+ * @param state State to convert
+ *
+ * @return Output row
+ */
+static Row getRow(const GeneratorState &state)
+{
+    return addState(Row { { "advances", state.getAdvances() } }, state);
+}
+
+/**
+ * @brief Converts a Gen5 searcher state to an output row
+ *
+ * @param state State to convert
+ *
+ * @return Output row
+ */
+static Row getRow(const SearcherState5<State5> &state)
+{
+    return addState(Row { { "seed", state.getInitialSeed() },
+                          { "dateTime", state.getDateTime().toString() },
+                          { "timer0", state.getTimer0() },
+                          { "buttons", toInt(state.getButtons()) },
+                          { "advances", state.getState().getAdvances() } },
+                    state.getState());
+}
+
+/**
+ * @brief Converts a searcher state to an output row
+ *
+ * @param state State to convert
+ *
+ * @return Output row
+ */
+static Row getRow(const SearcherState &state)
+{
+    return addState(Row { { "seed", state.getSeed() } }, state);
+}
+
+/**
+ * @brief Converts a Gen4 searcher state to an output row
+ *
+ * @param state State to convert
+ *
+ * @return Output row
+ */
+static Row getRow(const SearcherState4 &state)
+{
+    return addState(Row { { "seed", state.getSeed() }, { "advances", state.getAdvances() } }, state);
+}
+
+/**
+ * @brief Converts a wild generator state to an output row
+ *
+ * @param state State to convert
+ *
+ * @return Output row
+ */
+static Row getRow(const WildGeneratorState &state)
+{
+    return addState(Row { { "advances", state.getAdvances() },
+                          { "slot", state.getEncounterSlot() },
+                          { "species", state.getSpecie() },
+                          { "level", state.getLevel() } },
+                    state);
+}
+
+/**
+ * @brief Converts a wild searcher state to an output row
+ *
+ * @param state State to convert
+ *
+ * @return Output row
+ */
+static Row getRow(const WildSearcherState &state)
+{
+    return addState(Row { { "seed", state.getSeed() },
+                          { "lead", toInt(state.getLead()) },
+                          { "slot", state.getEncounterSlot() },
+                          { "species", state.getSpecie() },
+                          { "level", state.getLevel() } },
+                    state);
+}
+
+/**
+ * @brief Converts a TID/SID state to an output row
+ *
+ * @param state State to convert
+ *
+ * @return Output row
+ */
+static Row getRow(const IDState4 &state)
+{
+    return Row { { "seed", state.getSeed() }, { "delay", state.getDelay() }, { "seconds", state.getSeconds() },
+                 { "tid", state.getTID() },   { "sid", state.getSID() },     { "tsv", state.getTSV() } };
+}
+
+/**
+ * @brief Splits an inclusive range into contiguous chunks, one per thread
+ *
+ * @param min Start of the range
+ * @param max End of the range
+ * @param threads Number of threads
+ *
+ * @return Vector of inclusive chunks
+ */
+static std::vector<std::pair<u32, u32>> splitRange(u32 min, u32 max, int threads)
+{
+    std::vector<std::pair<u32, u32>> chunks;
+    if (min > max)
+    {
+        return chunks;
+    }
+
+    u64 size = static_cast<u64>(max) - min + 1;
+    u64 count = std::min<u64>(std::max(threads, 1), size);
+    for (u64 i = 0; i < count; i++)
+    {
+        chunks.emplace_back(min + size * i / count, min + size * (i + 1) / count - 1);
+    }
+    return chunks;
+}
+
+/**
+ * @brief Writes the combined telemetry of one or more searchers to stderr
+ *
+ * @param snapshots Telemetry of each searcher
+ */
+static void printTelemetry(const std::vector<SearchTelemetrySnapshot> &snapshots)
+{
+    constexpr const char *stages[FilterStageCount] = { "ability", "gender", "hidden power", "nature", "shiny", "IV", "slot" };
+
+    SearchTelemetrySnapshot total = {};
+    for (const auto &snapshot : snapshots)
+    {
+        total.elapsed = std::max(total.elapsed, snapshot.elapsed);
+        total.progressRate += snapshot.progressRate;
+        total.waitTime += snapshot.waitTime;
+        total.candidates += snapshot.candidates;
+        total.hits += snapshot.hits;
+        total.progress += snapshot.progress;
+        for (size_t i = 0; i < FilterStageCount; i++)
+        {
+            total.rejections[i] += snapshot.rejections[i];
+        }
+        total.threadUtilization.insert(total.threadUtilization.end(), snapshot.threadUtilization.begin(),
+                                       snapshot.threadUtilization.end());
+    }
+
+    char line[256];
+    std::snprintf(line, sizeof(line), "[%.1fs] progress %llu (%.0f/s), candidates %llu, hits %llu, waiting %.2fs", total.elapsed,
+                  static_cast<unsigned long long>(total.progress), total.progressRate, static_cast<unsigned long long>(total.candidates),
+                  static_cast<unsigned long long>(total.hits), total.waitTime);
+    std::cerr << line << "\n  rejected:";
+    for (size_t i = 0; i < FilterStageCount; i++)
+    {
+        std::cerr << (i == 0 ? " " : ", ") << stages[i] << ' ' << total.rejections[i];
+    }
+    std::cerr << '\n';
+
+    if (!total.threadUtilization.empty())
+    {
+        std::cerr << "  threads:";
+        for (double utilization : total.threadUtilization)
+        {
+            std::snprintf(line, sizeof(line), " %.0f%%", utilization * 100);
+            std::cerr << line;
+        }
+        std::cerr << '\n';
+    }
+}
+
+/**
+ * @brief Runs one searcher per thread and writes their results while they are searching. Searchers pause when the
+ * writer falls behind so memory use stays bounded.
+ *
+ * @param searchers Searchers to run
+ * @param start Starts the search of a searcher given its index
+ * @param writer Destination of the results
+ * @param telemetry Whether to report search telemetry to stderr every second
+ * @param convert Converts a result of a searcher to an output row, or an empty optional to skip the result
+ */
+template <class Searcher, class Start, class Convert>
+static void streamSearchers(std::vector<std::unique_ptr<Searcher>> &searchers, Start start, ResultWriter &writer, bool telemetry,
+                            Convert convert)
+{
+    std::atomic<size_t> running = searchers.size();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < searchers.size(); i++)
+    {
+        if (telemetry)
+        {
+            searchers[i]->enableTelemetry();
+        }
+        searchers[i]->setResultLimit(0x10000);
+        threads.emplace_back([&, i] {
+            start(*searchers[i], i);
+            running--;
+        });
+    }
+
+    bool finished;
+    int ticks = 0;
+    u64 skipped = 0;
+    do
+    {
+        finished = running == 0;
+        for (auto &searcher : searchers)
+        {
+            for (const auto &state : searcher->getResults())
+            {
+                if (auto row = convert(*searcher, state))
+                {
+                    writer.write(*row);
+                }
+                else
+                {
+                    skipped++;
+                }
+            }
+        }
+        writer.flush();
+
+        // Counted after the results are collected so pending results are not counted twice
+        if (telemetry && (finished || ++ticks % 5 == 0))
+        {
+            std::vector<SearchTelemetrySnapshot> snapshots;
+            for (auto &searcher : searchers)
+            {
+                snapshots.emplace_back(searcher->getTelemetry());
+            }
+            printTelemetry(snapshots);
+        }
+
+        if (!finished)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        }
+    } while (!finished);
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    if (skipped != 0)
+    {
+        std::cerr << skipped << " results could not be rebuilt and were skipped\n";
+    }
+}
+
+/**
+ * @brief Runs one searcher per thread and writes their results while they are searching
+ *
+ * @param searchers Searchers to run
+ * @param start Starts the search of a searcher given its index
+ * @param writer Destination of the results
+ * @param telemetry Whether to report search telemetry to stderr every second
+ */
+template <class Searcher, class Start>
+static void streamSearchers(std::vector<std::unique_ptr<Searcher>> &searchers, Start start, ResultWriter &writer, bool telemetry)
+{
+    streamSearchers(searchers, start, writer, telemetry,
+                    [](const Searcher &, const auto &state) { return std::optional<Row>(getRow(state)); });
+}
+
+/**
+ * @brief Writes the states of a generator
+ *
+ * @param states States to write
+ * @param writer Destination of the results
+ */
+template <class State>
+static void writeStates(const std::vector<State> &states, ResultWriter &writer)
+{
+    for (const auto &state : states)
+    {
+        writer.write(getRow(state));
+    }
+}
+
+/**
+ * @brief Runs a single searcher while its results are exported straight to the file named by the export settings of the job.
+ * Nothing is written to \p writer, the export keeps the results out of memory instead.
+ *
+ * @param searcher Searcher to run
+ * @param columns Columns to export
+ * @param job Job specification
+ * @param start Starts the search
+ * @param convert Converts a result of the searcher to the row that is exported, or an empty optional to skip the result
+ */
+template <class Result, class Row, class Start, class Convert>
+static void exportSearcher(SearcherBase<Result> &searcher, const std::vector<ResultColumn<Row>> &columns, const json &job, Start start,
+                           Convert convert)
+{
+    const json &j = job.at("export");
+    std::string format = j.value("format", "csv");
+    if (format != "csv" && format != "binary")
+    {
+        throw std::runtime_error("Unknown export format: " + format);
+    }
+
+    ResultExporter<Result, Row> exporter(searcher, columns, format == "csv" ? ExportFormat::CSV : ExportFormat::Binary,
+                                         j.value("limit", 0x10000), convert);
+    std::string path = j.at("path").get<std::string>();
+    if (!exporter.start(path))
+    {
+        throw std::runtime_error("Unable to open export: " + path);
+    }
+
+    start();
+    exporter.finish();
+    std::cerr << exporter.getCount() << " results exported\n";
+    if (exporter.getSkipped() != 0)
+    {
+        std::cerr << exporter.getSkipped() << " results could not be rebuilt and were skipped\n";
+    }
+}
+
+/**
+ * @brief Runs a GameCube seed searcher, resuming from a checkpoint and restricting the search range if requested
+ *
+ * @param searcher Seed searcher
+ * @param job Job specification
+ * @param threads Number of threads to search with
+ * @param writer Destination of the results
+ */
+template <class Searcher>
+static void runSeedSearcher(Searcher &searcher, const json &job, int threads, ResultWriter &writer)
+{
+    if (job.contains("checkpoint"))
+    {
+        searcher.setCheckpoint(job["checkpoint"].get<std::string>());
+    }
+
+    if (job.contains("range"))
+    {
+        auto range = job["range"].get<std::array<u32, 2>>();
+        searcher.setRange(range[0], range[1]);
+    }
+
+    bool telemetry = job.value("telemetry", false);
+    if (telemetry)
+    {
+        searcher.enableTelemetry();
+    }
+
+    // Results are only unique once the search completes so they are written at the end
+    searcher.startSearch(threads);
+    if (telemetry)
+    {
+        printTelemetry({ searcher.getTelemetry() });
+    }
+    for (u32 seed : searcher.getResults())
+    {
+        writer.write(Row { { "seed", seed } });
+    }
+}
+
+static void runChannel(const json &job, int threads, ResultWriter &writer)
+{
+    ChannelSeedSearcher searcher(job.at("criteria").get<std::vector<u8>>());
+    runSeedSearcher(searcher, job, threads, writer);
+}
+
+static void runColo(const json &job, int threads, ResultWriter &writer)
+{
+    ColoSeedSearcher searcher({ job.at("lead").get<u8>(), job.at("trainer").get<u8>() });
+    runSeedSearcher(searcher, job, threads, writer);
+}
+
+static void runGales(const json &job, int threads, ResultWriter &writer)
+{
+    auto enemyHP = job.at("enemyHP").get<std::array<u16, 2>>();
+    auto playerHP = job.at("playerHP").get<std::array<u16, 2>>();
+    GalesCriteria criteria
+        = { { enemyHP[0], enemyHP[1] }, { playerHP[0], playerHP[1] }, job.at("enemyIndex").get<u8>(), job.at("playerIndex").get<u8>() };
+
+    GalesSeedSearcher searcher(criteria);
+    runSeedSearcher(searcher, job, threads, writer);
+}
+
+static void runStatic3(const json &job, int threads, ResultWriter &writer)
+{
+    Profile3 profile = getProfile3(job);
+    StateFilter filter = getStateFilter(job);
+    auto min = getIVs(job, "min", 0);
+    auto max = getIVs(job, "max", 31);
+    auto method = static_cast<Method>(job.value("method", toInt(Method::Method1)));
+    const StaticTemplate3 *staticTemplate = getStaticTemplate(job, Encounters3::getStaticEncounters, 10);
+
+    // Each thread searches a slice of the HP IVs
+    auto chunks = splitRange(min[0], max[0], threads);
+    std::vector<std::unique_ptr<StaticSearcher3>> searchers;
+    for (size_t i = 0; i < chunks.size(); i++)
+    {
+        searchers.emplace_back(std::make_unique<StaticSearcher3>(method, profile, filter));
+    }
+
+    streamSearchers(
+        searchers,
+        [&](StaticSearcher3 &searcher, size_t i) {
+            auto chunkMin = min;
+            auto chunkMax = max;
+            chunkMin[0] = chunks[i].first;
+            chunkMax[0] = chunks[i].second;
+            searcher.startSearch(chunkMin, chunkMax, staticTemplate);
+        },
+        writer, job.value("telemetry", false));
+}
+
+static void runStatic3Generator(const json &job, int, ResultWriter &writer)
+{
+    Profile3 profile = getProfile3(job);
+    auto method = static_cast<Method>(job.value("method", toInt(Method::Method1)));
+    const StaticTemplate3 *staticTemplate = getStaticTemplate(job, Encounters3::getStaticEncounters, 10);
+
+    StaticGenerator3 generator(job.value("initialAdvances", 0), job.value("maxAdvances", 1000), job.value("offset", 0), method,
+                               *staticTemplate, profile, getStateFilter(job));
+    writeStates(generator.generate(job.at("seed").get<u32>()), writer);
+}
+
+static void runWild3(const json &job, int threads, ResultWriter &writer)
+{
+    Profile3 profile = getProfile3(job);
+    WildStateFilter filter = getWildStateFilter(job);
+    auto min = getIVs(job, "min", 0);
+    auto max = getIVs(job, "max", 31);
+    auto method = static_cast<Method>(job.value("method", toInt(Method::Method1)));
+    auto leads = getLeads(job);
+    EncounterArea3 area = getEncounterArea3(job, profile);
+
+    // Each thread searches a slice of the HP IVs
+    auto chunks = splitRange(min[0], max[0], threads);
+    std::vector<std::unique_ptr<WildSearcher3>> searchers;
+    for (size_t i = 0; i < chunks.size(); i++)
+    {
+        searchers.emplace_back(std::make_unique<WildSearcher3>(method, leads, job.value("feebasTile", false), area, profile, filter));
+    }
+
+    streamSearchers(
+        searchers,
+        [&](WildSearcher3 &searcher, size_t i) {
+            auto chunkMin = min;
+            auto chunkMax = max;
+            chunkMin[0] = chunks[i].first;
+            chunkMax[0] = chunks[i].second;
+            searcher.startSearch(chunkMin, chunkMax);
+        },
+        writer, job.value("telemetry", false));
+}
+
+static void runWild3Generator(const json &job, int, ResultWriter &writer)
+{
+    Profile3 profile = getProfile3(job);
+    auto method = static_cast<Method>(job.value("method", toInt(Method::Method1)));
+    auto lead = static_cast<Lead>(job.value("lead", toInt(Lead::None)));
+
+    WildGenerator3 generator(job.value("initialAdvances", 0), job.value("maxAdvances", 1000), job.value("offset", 0), method, lead,
+                             job.value("feebasTile", false), getEncounterArea3(job, profile), profile, getWildStateFilter(job));
+    writeStates(generator.generate(job.at("seed").get<u32>()), writer);
+}
+
+static void runEvent4(const json &job, int threads, ResultWriter &writer)
+{
+    Profile4 profile = getProfile4(job);
+    StateFilter filter = getStateFilter(job);
+    auto min = getIVs(job, "min", 0);
+    auto max = getIVs(job, "max", 31);
+    u16 species = job.at("species").get<u16>();
+    u8 nature = job.at("nature").get<u8>();
+    u8 level = job.at("level").get<u8>();
+
+    // Each thread searches a slice of the HP IVs
+    auto chunks = splitRange(min[0], max[0], threads);
+    std::vector<std::unique_ptr<EventSearcher4>> searchers;
+    for (size_t i = 0; i < chunks.size(); i++)
+    {
+        searchers.emplace_back(std::make_unique<EventSearcher4>(job.value("minAdvance", 0), job.value("maxAdvance", 1000),
+                                                                job.value("minDelay", 600), job.value("maxDelay", 2000), profile, filter));
+    }
+
+    streamSearchers(
+        searchers,
+        [&](EventSearcher4 &searcher, size_t i) {
+            auto chunkMin = min;
+            auto chunkMax = max;
+            chunkMin[0] = chunks[i].first;
+            chunkMax[0] = chunks[i].second;
+            searcher.startSearch(chunkMin, chunkMax, species, nature, level);
+        },
+        writer, job.value("telemetry", false));
+}
+
+static void runID4(const json &job, int threads, ResultWriter &writer)
+{
+    IDFilter filter(job.value("tid", std::vector<u16>()), job.value("sid", std::vector<u16>()), job.value("tsv", std::vector<u16>()), {});
+    u16 year = job.value("year", 2000);
+    u32 minDelay = job.value("minDelay", 5000);
+    u32 maxDelay = job.value("infinite", false) ? 0xe8ffff : job.value("maxDelay", 6000);
+
+    // Each thread searches a slice of the delays
+    auto chunks = splitRange(minDelay, maxDelay, threads);
+    std::vector<std::unique_ptr<IDSearcher4>> searchers;
+    for (size_t i = 0; i < chunks.size(); i++)
+    {
+        searchers.emplace_back(std::make_unique<IDSearcher4>(filter));
+        if (job.contains("checkpoint"))
+        {
+            // Every slice keeps its own checkpoint. Slices are part of the checkpoint identity so resuming with a different
+            // thread count starts over.
+            searchers[i]->setCheckpoint(job["checkpoint"].get<std::string>() + "." + std::to_string(i), getJobKey(job));
+        }
+    }
+
+    streamSearchers(
+        searchers, [&](IDSearcher4 &searcher, size_t i) { searcher.startSearch(false, year, chunks[i].first, chunks[i].second); },
+        writer, job.value("telemetry", false));
+}
+
+static void runStatic4(const json &job, int threads, ResultWriter &writer)
+{
+    Profile4 profile = getProfile4(job);
+    StateFilter filter = getStateFilter(job);
+    auto min = getIVs(job, "min", 0);
+    auto max = getIVs(job, "max", 31);
+    auto lead = static_cast<Lead>(job.value("lead", toInt(Lead::None)));
+    const StaticTemplate4 *staticTemplate = getStaticTemplate(job, Encounters4::getStaticEncounters, 8);
+
+    // Each thread searches a slice of the HP IVs
+    auto chunks = splitRange(min[0], max[0], threads);
+    std::vector<std::unique_ptr<StaticSearcher4>> searchers;
+    for (size_t i = 0; i < chunks.size(); i++)
+    {
+        searchers.emplace_back(std::make_unique<StaticSearcher4>(job.value("minAdvance", 0), job.value("maxAdvance", 1000),
+                                                                 job.value("minDelay", 600), job.value("maxDelay", 2000),
+                                                                 staticTemplate->getMethod(), lead, profile, filter));
+    }
+
+    streamSearchers(
+        searchers,
+        [&](StaticSearcher4 &searcher, size_t i) {
+            auto chunkMin = min;
+            auto chunkMax = max;
+            chunkMin[0] = chunks[i].first;
+            chunkMax[0] = chunks[i].second;
+            searcher.startSearch(chunkMin, chunkMax, staticTemplate);
+        },
+        writer, job.value("telemetry", false));
+}
+
+static void runStatic4Generator(const json &job, int, ResultWriter &writer)
+{
+    Profile4 profile = getProfile4(job);
+    auto lead = static_cast<Lead>(job.value("lead", toInt(Lead::None)));
+    const StaticTemplate4 *staticTemplate = getStaticTemplate(job, Encounters4::getStaticEncounters, 8);
+
+    StaticGenerator4 generator(job.value("initialAdvances", 0), job.value("maxAdvances", 1000), job.value("offset", 0),
+                               staticTemplate->getMethod(), lead, *staticTemplate, profile, getStateFilter(job));
+    writeStates(generator.generate(job.at("seed").get<u32>()), writer);
+}
+
+static void runEvent5(const json &job, int threads, ResultWriter &writer)
+{
+    Profile5 profile = getProfile5(job);
+    Date start = getDate(job, "start");
+    Date end = getDate(job, "end");
+    if (start > end)
+    {
+        throw std::runtime_error("Start date is after end date");
+    }
+
+    // IVs of 255 are random
+    const json &j = job.at("pgf");
+    auto ivs = j.value("ivs", std::array<u8, 6> { 255, 255, 255, 255, 255, 255 });
+    PGF pgf(j.value("tid", 0), j.value("sid", 0), j.at("species").get<u16>(), j.value("nature", 255), j.value("gender", 255),
+            j.value("ability", 255), j.value("shiny", 0), j.at("level").get<u8>(), ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5],
+            j.value("egg", false));
+    EventGenerator5 generator(job.value("initialAdvances", 0), job.value("maxAdvances", 0), 0, pgf, profile, getStateFilter(job));
+
+    // The searcher splits the dates and Timer0 values between its own threads. It only keeps compact keys, the full rows are
+    // regenerated as they are written.
+    using Searcher = Searcher5<EventGenerator5, State5, SearcherKey5>;
+    std::vector<std::unique_ptr<Searcher>> searchers;
+    searchers.emplace_back(std::make_unique<Searcher>(generator, profile));
+    if (job.contains("checkpoint"))
+    {
+        searchers[0]->setCheckpoint(job["checkpoint"].get<std::string>(), getJobKey(job));
+    }
+
+    if (job.contains("export"))
+    {
+        using Result = SearcherState5<State5>;
+        std::vector<ResultColumn<Result>> columns
+            = { { "seed", 8, [](const Result &result) { return result.getInitialSeed(); } },
+                { "date", 4, [](const Result &result) { return result.getDateTime().getDate().getJD(); } },
+                { "time", 4,
+                  [](const Result &result) {
+                      Time time = result.getDateTime().getTime();
+                      return time.hour() * 3600 + time.minute() * 60 + time.second();
+                  } },
+                { "timer0", 2, [](const Result &result) { return result.getTimer0(); } },
+                { "buttons", 2, [](const Result &result) { return toInt(result.getButtons()); } },
+                { "advances", 4, [](const Result &result) { return result.getState().getAdvances(); } },
+                { "pid", 4, [](const Result &result) { return result.getState().getPID(); } },
+                { "nature", 1, [](const Result &result) { return result.getState().getNature(); } },
+                { "ability", 1, [](const Result &result) { return result.getState().getAbility(); } },
+                { "gender", 1, [](const Result &result) { return result.getState().getGender(); } },
+                { "shiny", 1, [](const Result &result) { return result.getState().getShiny(); } } };
+
+        constexpr const char *stats[6] = { "hp", "atk", "def", "spa", "spd", "spe" };
+        for (int i = 0; i < 6; i++)
+        {
+            columns.push_back({ stats[i], 1, [i](const Result &result) { return result.getState().getIV(i); } });
+        }
+        exportSearcher(
+            *searchers[0], columns, job, [&] { searchers[0]->startSearch(threads, start, end); },
+            [&](const SearcherKey5 &key) { return searchers[0]->reconstruct(key); });
+        return;
+    }
+
+    streamSearchers(
+        searchers, [&](Searcher &searcher, size_t) { searcher.startSearch(threads, start, end); }, writer, job.value("telemetry", false),
+        [](const Searcher &searcher, const SearcherKey5 &key) -> std::optional<Row> {
+            auto state = searcher.reconstruct(key);
+            return state ? std::optional<Row>(getRow(*state)) : std::nullopt;
+        });
+}
+
+static void runStatic8Generator(const json &job, int, ResultWriter &writer)
+{
+    Profile8 profile = getProfile8(job);
+    auto lead = static_cast<Lead>(job.value("lead", toInt(Lead::None)));
+    const StaticTemplate8 *staticTemplate = getStaticTemplate(job, Encounters8::getStaticEncounters, 9);
+
+    StaticGenerator8 generator(job.value("initialAdvances", 0), job.value("maxAdvances", 1000), job.value("offset", 0), lead,
+                               *staticTemplate, profile, getStateFilter(job));
+    writeStates(generator.generate(job.at("seed0").get<u64>(), job.at("seed1").get<u64>()), writer);
+}
+
+constexpr JobType jobTypes[] = { { "channel", runChannel },
+                                 { "colo", runColo },
+                                 { "event4", runEvent4 },
+                                 { "event5", runEvent5 },
+                                 { "gales", runGales },
+                                 { "id4", runID4 },
+                                 { "static3", runStatic3 },
+                                 { "static3generator", runStatic3Generator },
+                                 { "static4", runStatic4 },
+                                 { "static4generator", runStatic4Generator },
+                                 { "static8generator", runStatic8Generator },
+                                 { "wild3", runWild3 },
+                                 { "wild3generator", runWild3Generator } };
+
+namespace Jobs
+{
+    std::vector<std::string> getTypes()
+    {
+        std::vector<std::string> types;
+        for (const auto &type : jobTypes)
+        {
+            types.emplace_back(type.name);
+        }
+        return types;
+    }
+
+    bool run(const json &job, int threads, ResultWriter &writer)
+    {
+        std::string type = job.at("type").get<std::string>();
+        for (const auto &jobType : jobTypes)
+        {
+            if (type == jobType.name)
+            {
+                jobType.run(job, threads, writer);
+                writer.flush();
+                return true;
+            }
+        }
+        return false;
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef JOBS_HPP
+#define JOBS_HPP
+
+#include <json.hpp>
+#include <string>
+#include <vector>
+
+class ResultWriter;
+
+namespace Jobs
+{
+    /**
+     * @brief Returns the job types that can be run
+     *
+     * @return Vector of job types
+     */
+    std::vector<std::string> getTypes();
+
+    /**
+     * @brief Runs the job described by \p job, writing results as they are found
+     *
+     * @param job Job specification
+     * @param threads Number of threads to search with
+     * @param writer Destination of the results
+     *
+     * @return true Job was run
+     * @return false Job type is unknown
+     */
+    bool run(const nlohmann::json &job, int threads, ResultWriter &writer);
+}
+
+#endif // JOBS_HPP
@@ -0,0 +1,113 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "ResultWriter.hpp"
+
+/**
+ * @brief Converts a JSON value to a CSV field
+ *
+ * @param value Value to convert
+ *
+ * @return CSV field
+ */
+static std::string getField(const nlohmann::ordered_json &value)
+{
+    if (value.is_string())
+    {
+        std::string text = value.get<std::string>();
+        if (text.find_first_of(",\"\n") == std::string::npos)
+        {
+            return text;
+        }
+
+        std::string quoted = "\"";
+        for (char c : text)
+        {
+            if (c == '"')
+            {
+                quoted += '"';
+            }
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
+    else if (value.is_array())
+    {
+        std::string field;
+        for (const auto &element : value)
+        {
+            if (!field.empty())
+            {
+                field += '/';
+            }
+            field += element.dump();
+        }
+        return field;
+    }
+    return value.dump();
+}
+
+ResultWriter::ResultWriter(std::ostream &stream, OutputFormat format) : stream(stream), count(0), format(format)
+{
+}
+
+void ResultWriter::flush()
+{
+    stream.flush();
+}
+
+u64 ResultWriter::getCount() const
+{
+    return count;
+}
+
+void ResultWriter::write(const nlohmann::ordered_json &row)
+{
+    if (format == OutputFormat::NDJSON)
+    {
+        stream << row.dump() << '\n';
+    }
+    else
+    {
+        if (header.empty())
+        {
+            for (const auto &item : row.items())
+            {
+                header.emplace_back(item.key());
+            }
+
+            for (size_t i = 0; i < header.size(); i++)
+            {
+                stream << (i == 0 ? "" : ",") << header[i];
+            }
+            stream << '\n';
+        }
+
+        for (size_t i = 0; i < header.size(); i++)
+        {
+            stream << (i == 0 ? "" : ",");
+            if (row.contains(header[i]))
+            {
+                stream << getField(row[header[i]]);
+            }
+        }
+        stream << '\n';
+    }
+    count++;
+}
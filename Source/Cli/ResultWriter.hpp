@@ -0,0 +1,78 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef RESULTWRITER_HPP
+#define RESULTWRITER_HPP
+
+#include <Core/Global.hpp>
+#include <json.hpp>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Output formats supported by the command line interface
+ */
+enum class OutputFormat : u8
+{
+    NDJSON,
+    CSV
+};
+
+/**
+ * @brief Writes search results to a stream as they are produced
+ */
+class ResultWriter
+{
+public:
+    /**
+     * @brief Construct a new ResultWriter object
+     *
+     * @param stream Stream to write to
+     * @param format Output format
+     */
+    ResultWriter(std::ostream &stream, OutputFormat format);
+
+    /**
+     * @brief Flushes any buffered results to the stream
+     */
+    void flush();
+
+    /**
+     * @brief Returns the number of results written
+     *
+     * @return Result count
+     */
+    u64 getCount() const;
+
+    /**
+     * @brief Writes a single result. CSV output takes its header from the keys of the first result.
+     *
+     * @param row Result to write
+     */
+    void write(const nlohmann::ordered_json &row);
+
+private:
+    std::ostream &stream;
+    std::vector<std::string> header;
+    u64 count;
+    OutputFormat format;
+};
+
+#endif // RESULTWRITER_HPP
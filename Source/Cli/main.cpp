@@ -0,0 +1,199 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Jobs.hpp"
+#include "ResultWriter.hpp"
+#include <Core/Enum/Method.hpp>
+#include <Core/RNG/IVSeedTable.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+using json = nlohmann::json;
+
+/**
+ * @brief Prints the command line usage
+ *
+ * @param name Executable name
+ */
+static void printUsage(const char *name)
+{
+    std::cerr << "Usage: " << name << " [--threads N] [--format ndjson|csv] [--output FILE] [--iv-table FILE]... [--telemetry] JOB\n"
+              << "       " << name << " --build-iv-table 1|4 FILE\n"
+              << "       " << name << " --list\n\n"
+              << "JOB is a JSON job specification file, or - to read it from stdin.\n"
+              << "Results are written to stdout unless an output file is given.\n"
+              << "IV seed tables speed up repeated wide Gen 3/4 IV searches. Build one for Method 1/2/J/K (1) or Method 4 (4).\n"
+              << "Telemetry reports throughput, filter rejections, and thread utilization to stderr while searching.\n";
+}
+
+/**
+ * @brief Runs a search from a JSON job specification without starting the interface
+ *
+ * @param argc Number of arguments
+ * @param argv Char array of arguments
+ *
+ * @return Exit code
+ */
+int main(int argc, char *argv[])
+{
+    std::string jobPath;
+    std::string output;
+    std::string format;
+    int threads = 0;
+    bool telemetry = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--list") == 0)
+        {
+            for (const auto &type : Jobs::getTypes())
+            {
+                std::cout << type << '\n';
+            }
+            return 0;
+        }
+        else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+        {
+            threads = std::atoi(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+        {
+            format = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--telemetry") == 0)
+        {
+            telemetry = true;
+        }
+        else if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+        {
+            output = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--iv-table") == 0 && i + 1 < argc)
+        {
+            if (!IVSeedTable::load(argv[++i]))
+            {
+                std::cerr << "Invalid IV seed table: " << argv[i] << '\n';
+                return 1;
+            }
+        }
+        else if (std::strcmp(argv[i], "--build-iv-table") == 0 && i + 2 < argc)
+        {
+            Method method = std::strcmp(argv[i + 1], "4") == 0 ? Method::Method4 : Method::Method1;
+            if (!IVSeedTable::build(argv[i + 2], method))
+            {
+                std::cerr << "Unable to write IV seed table: " << argv[i + 2] << '\n';
+                return 1;
+            }
+            return 0;
+        }
+        else if (jobPath.empty() && (argv[i][0] != '-' || argv[i][1] == '\0'))
+        {
+            jobPath = argv[i];
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (jobPath.empty())
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    json job;
+    if (jobPath == "-")
+    {
+        job = json::parse(std::cin, nullptr, false);
+    }
+    else
+    {
+        std::ifstream read(jobPath);
+        job = json::parse(read, nullptr, false);
+    }
+
+    if (job.is_discarded() || !job.is_object())
+    {
+        std::cerr << "Invalid job specification: " << jobPath << '\n';
+        return 1;
+    }
+
+    // Command line options take priority over the job specification
+    if (threads <= 0)
+    {
+        threads = job.value("threads", static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    threads = std::max(threads, 1);
+
+    if (format.empty())
+    {
+        format = job.value("format", "ndjson");
+    }
+
+    if (format != "ndjson" && format != "csv")
+    {
+        std::cerr << "Unknown format: " << format << '\n';
+        return 1;
+    }
+
+    if (telemetry)
+    {
+        job["telemetry"] = true;
+    }
+
+    if (output.empty())
+    {
+        output = job.value("output", "-");
+    }
+
+    std::ofstream file;
+    if (output != "-")
+    {
+        file.open(output);
+        if (!file.is_open())
+        {
+            std::cerr << "Unable to open output: " << output << '\n';
+            return 1;
+        }
+    }
+
+    ResultWriter writer(output == "-" ? std::cout : file, format == "csv" ? OutputFormat::CSV : OutputFormat::NDJSON);
+    try
+    {
+        if (!Jobs::run(job, threads, writer))
+        {
+            std::cerr << "Unknown job type: " << job.value("type", "") << '\n';
+            return 1;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Job failed: " << e.what() << '\n';
+        return 1;
+    }
+
+    std::cerr << writer.getCount() << " results\n";
+    return 0;
+}
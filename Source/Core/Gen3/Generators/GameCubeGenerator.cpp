@@ -34,6 +34,58 @@ static bool isShiny(u16 high, u16 low, u16 tsv)
     return (high ^ low ^ tsv) < 8;
 }
 
+/**
+ * @brief Remembers where the PID reroll of a shadow lock ended. Consecutive advances start their reroll one advance apart, so
+ * every advance of the same parity that starts before the matching PID lands on the same PID without walking the reroll again.
+ */
+class LockWindow
+{
+public:
+    /**
+     * @brief Construct a new LockWindow object
+     */
+    LockWindow() : end { 0, 0 }, start { 0, 0 }
+    {
+    }
+
+    /**
+     * @brief Finds where the PID reroll of the lock ends
+     *
+     * @param seed PRNG state that positions are relative to
+     * @param position Advance the PID reroll starts from
+     * @param lock Shadow lock to satisfy
+     *
+     * @return Advance after the PID that satisfies the lock
+     */
+    u32 find(u32 seed, u32 position, const LockInfo &lock)
+    {
+        u8 parity = position & 1;
+        if (position >= start[parity] && position + 2 <= end[parity])
+        {
+            return end[parity];
+        }
+
+        XDRNG rng(seed, position);
+        u32 count = position;
+        u32 pid;
+        do
+        {
+            u16 high = rng.nextUShort();
+            u16 low = rng.nextUShort();
+            pid = (high << 16) | low;
+            count += 2;
+        } while (!lock.compare(pid));
+
+        start[parity] = position;
+        end[parity] = count;
+        return count;
+    }
+
+private:
+    u32 end[2];
+    u32 start[2];
+};
+
 GameCubeGenerator::GameCubeGenerator(u32 initialAdvances, u32 maxAdvances, u32 offset, Method method, bool unset, const Profile3 &profile,
                                      const StateFilter &filter) :
     Generator(initialAdvances, maxAdvances, offset, method, profile, filter), unset(unset)
@@ -129,6 +181,9 @@ std::vector<GeneratorState> GameCubeGenerator::generateColoShadow(u32 seed, cons
     const PersonalInfo *info = shadowTemplate->getInfo();
 
     XDRNG rng(seed, initialAdvances + offset);
+    u32 base = rng.getSeed();
+
+    std::array<LockWindow, 5> windows;
     for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
     {
         XDRNG go(rng);
@@ -136,34 +191,23 @@ std::vector<GeneratorState> GameCubeGenerator::generateColoShadow(u32 seed, cons
         // Trainer TID/SID
         u16 trainerTSV = go.nextUShort() ^ go.nextUShort();
 
-        u8 ability;
-        u16 high;
-        u16 low;
+        // The end of each PID reroll only depends on where it starts so it is shared between advances
+        u32 position = cnt + 2;
+        u32 abilityPosition = position;
         for (s8 i = 0; i < shadowTemplate->getCount(); i++)
         {
-            const LockInfo &lock = shadowTemplate->getLock(i);
-
             // Temporary PID: 2 advances
             // IVs: 2 advances
             // Ability: 1 state
-            go.advance(4);
-            ability = go.nextUShort(2);
-
-            u32 pid;
-            do
-            {
-                high = go.nextUShort();
-                low = go.nextUShort();
-                pid = (high << 16) | low;
-
-                // Shiny lock is from enemy TSV
-                if (isShiny(high, low, trainerTSV))
-                {
-                    continue;
-                }
-            } while (!lock.compare(pid));
+            abilityPosition = position + 4;
+            position = windows[i].find(base, position + 5, shadowTemplate->getLock(i));
         }
 
+        go = XDRNG(base, position - 2);
+        u8 ability = XDRNG(base, abilityPosition).nextUShort(2);
+        u16 high = go.nextUShort();
+        u16 low = go.nextUShort();
+
         // E-Reader is included as part of the above loop, just need to set IVs to 0
         u16 iv1;
         u16 iv2;
@@ -218,12 +262,13 @@ std::vector<GeneratorState> GameCubeGenerator::generateGalesShadow(u32 seed, con
     const PersonalInfo *info = shadowTemplate->getInfo();
 
     XDRNG rng(seed, initialAdvances + offset);
+    u32 base = rng.getSeed();
+
+    std::array<LockWindow, 5> windows;
     for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
     {
-        XDRNG go(rng);
-
         // Enemy TID/SID
-        go.advance(2);
+        u32 position = cnt + 2;
 
         for (s8 i = 0; i < shadowTemplate->getCount(); i++)
         {
@@ -232,28 +277,18 @@ std::vector<GeneratorState> GameCubeGenerator::generateGalesShadow(u32 seed, con
             // Temporary PID: 2 advances
             // IVs: 2 advances
             // Ability: 1 advance
-            go.advance(5);
+            position += 5;
 
             // If we are looking at a shadow pokemon
             // We will assume it is already set and skip the PID process
             if (!lock.getIgnore())
             {
-                u32 pid;
-                do
-                {
-                    u16 high = go.nextUShort();
-                    u16 low = go.nextUShort();
-                    pid = (high << 16) | low;
-
-                    // Shiny lock is from TSV of savefile
-                    if (isShiny(high, low, tsv))
-                    {
-                        continue;
-                    }
-                } while (!lock.compare(pid));
+                position = windows[i].find(base, position, lock);
             }
         }
 
+        XDRNG go(base, position);
+
         // Check for shiny lock with unset
         if ((shadowTemplate->getType() == ShadowType::SecondShadow || shadowTemplate->getType() == ShadowType::Salamence) && unset)
         {
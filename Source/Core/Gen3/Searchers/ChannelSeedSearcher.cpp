@@ -18,8 +18,25 @@
  */
 
 #include "ChannelSeedSearcher.hpp"
+#include <Core/Util/RadixSort.hpp>
 #include <algorithm>
-#include <thread>
+#include <array>
+
+constexpr u32 window = 0x400;
+
+// Pattern of each order the outputs 1, 2 and 3 first appear in, indexed by (n1 < n2) | (n1 < n3) << 1 | (n2 < n3) << 2 where nX is
+// the position of the first X. Indexes 2 and 5 are impossible orders.
+constexpr u8 patterns[8] = { 11, 13, 0, 15, 12, 0, 16, 17 };
+
+/**
+ * @brief Pattern and ending state of the outputs that start at a position of the PRNG cycle
+ */
+struct CycleEntry
+{
+    u32 seed;
+    u32 end;
+    u8 pattern;
+};
 
 ChannelSeedSearcher::ChannelSeedSearcher(const std::vector<u8> &criteria) : SeedSearcher(criteria)
 {
@@ -27,59 +44,97 @@ ChannelSeedSearcher::ChannelSeedSearcher(const std::vector<u8> &criteria) : Seed
 
 int ChannelSeedSearcher::getProgress() const
 {
-    return progress >> 1;
+    return static_cast<int>(progress.get() >> 1);
 }
 
 void ChannelSeedSearcher::startSearch(int threads)
 {
-    searching = true;
+    searchUnits(threads, 0, 0x10000, 0xc000, [this](u32 unit, std::vector<u32> &seeds) { return search(unit, seeds); });
 
-    auto *threadContainer = new std::thread[threads];
+    RadixSort::sortUnique(results, threads);
+}
 
-    u32 split = 0xBFFFFFFE / threads;
-    u32 start = 0x40000001;
-    for (int i = 0; i < threads; i++, start += split)
+bool ChannelSeedSearcher::search(u32 unit, std::vector<u32> &seeds)
+{
+    // Positions are counted from the end of the window back to the first state of the unit. Walking backwards means the pattern of
+    // every later position is already known, so each output is only computed once.
+    std::array<CycleEntry, window> entries;
+    u32 next[4] = { 0, 0xffffffff, 0xffffffff, 0xffffffff };
+    u32 count = 0;
+
+    XDRNGR rng(XDRNG(0, (unit << 16) + 0x10000 + window).getSeed());
+    for (u32 position = 0x10000 + window; position > 0; position--)
     {
-        if (i == threads - 1)
+        u32 seed = rng.getSeed();
+        u8 num = seed >> 30;
+        next[num] = position;
+
+        CycleEntry &entry = entries[position % window];
+        entry.seed = seed;
+        entry.end = std::max({ next[1], next[2], next[3] });
+        if (entry.end == 0xffffffff)
         {
-            threadContainer[i] = std::thread([=] { search(start, 0xffffffff); });
+            entry.pattern = 0;
         }
         else
         {
-            threadContainer[i] = std::thread([=] { search(start, start + split); });
+            u8 order = (next[1] < next[2]) | ((next[1] < next[3]) << 1) | ((next[2] < next[3]) << 2);
+            entry.pattern = patterns[order] << (num == 0);
         }
-    }
 
-    for (int i = 0; i < threads; i++)
-    {
-        threadContainer[i].join();
-    }
-
-    delete[] threadContainer;
+        u32 start = rng.next();
+        if (position > 0x10000 || start < 0x40000001 || start == 0xffffffff)
+        {
+            continue;
+        }
 
-    std::sort(results.begin(), results.end());
-    results.erase(std::unique(results.begin(), results.end()), results.end());
-}
+        // Progress is published in batches to keep the shared counter out of the loop
+        if ((++count & 0xfff) == 0)
+        {
+            if (!searching)
+            {
+                return false;
+            }
+            progress += 0x1000;
+        }
 
-void ChannelSeedSearcher::search(u32 start, u32 end)
-{
-    std::vector<u32> seeds;
-    for (u32 seed = start; seed < end; seed++, progress++)
-    {
-        if (!searching)
+        // Follow the criteria through the window, falling back to generating them when they reach past it
+        bool known = true;
+        bool valid = true;
+        u32 index = position;
+        for (u8 compare : criteria)
         {
-            return;
+            const CycleEntry &current = entries[index % window];
+            if (index - position >= window || current.pattern == 0 || current.end - position >= window)
+            {
+                known = false;
+                break;
+            }
+
+            if (current.pattern != compare)
+            {
+                valid = false;
+                break;
+            }
+            index = current.end + 1;
         }
 
-        XDRNG rng(seed);
-        if (searchSeed(rng))
+        if (!known)
         {
-            seeds.emplace_back(rng.getSeed());
+            XDRNG test(start);
+            if (searchSeed(test))
+            {
+                seeds.emplace_back(test.getSeed());
+            }
+        }
+        else if (valid)
+        {
+            seeds.emplace_back(index == position ? start : entries[(index - 1) % window].seed);
         }
     }
+    progress += count & 0xfff;
 
-    std::lock_guard<std::mutex> lock(mutex);
-    results.insert(results.end(), seeds.begin(), seeds.end());
+    return true;
 }
 
 bool ChannelSeedSearcher::searchSeed(XDRNG &rng) const
@@ -52,12 +52,16 @@ public:
 
 private:
     /**
-     * @brief Searches over a range of PRNG states for valid candidate seeds
+     * @brief Searches a work unit of PRNG states for valid candidate seeds. The work unit is 0x10000 consecutive states of the
+     * PRNG cycle that starts from seed 0, which are walked in reverse order so each output is only generated once.
      *
-     * @param start Lower PRNG state
-     * @param end Upper PRNG state
+     * @param unit Work unit of the PRNG cycle
+     * @param seeds Vector to store valid candidate seeds in
+     *
+     * @return true Work unit was completed
+     * @return false Search was cancelled
      */
-    void search(u32 start, u32 end);
+    bool search(u32 unit, std::vector<u32> &seeds);
 
     /**
      * @brief Determines if PRNG state is valid for the criteria
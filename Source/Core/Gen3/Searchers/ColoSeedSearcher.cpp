@@ -18,8 +18,7 @@
  */
 
 #include "ColoSeedSearcher.hpp"
-#include <algorithm>
-#include <thread>
+#include <Core/Util/RadixSort.hpp>
 
 constexpr u8 natures[8][6]
     = { { 0x16, 0x15, 0x0f, 0x13, 0x04, 0x04 }, { 0x0b, 0x08, 0x01, 0x10, 0x10, 0x0C }, { 0x02, 0x10, 0x0f, 0x12, 0x0f, 0x03 },
@@ -81,33 +80,9 @@ ColoSeedSearcher::ColoSeedSearcher(const ColoCriteria &criteria) : SeedSearcher(
 
 void ColoSeedSearcher::startSearch(int threads)
 {
-    searching = true;
-
-    auto *threadContainer = new std::thread[threads];
+    searchUnits(threads, 0, 0x10000, 1, [this](u32 low, std::vector<u32> &seeds) { return search(low, seeds); });
 
-    u32 split = 0x10000 / threads;
-    u32 start = 0;
-    for (int i = 0; i < threads; i++, start += split)
-    {
-        if (i == threads - 1)
-        {
-            threadContainer[i] = std::thread([=] { search(start, 0x10000); });
-        }
-        else
-        {
-            threadContainer[i] = std::thread([=] { search(start, start + split); });
-        }
-    }
-
-    for (int i = 0; i < threads; i++)
-    {
-        threadContainer[i].join();
-    }
-
-    delete[] threadContainer;
-
-    std::sort(results.begin(), results.end());
-    results.erase(std::unique(results.begin(), results.end()), results.end());
+    RadixSort::sortUnique(results, threads);
 }
 
 void ColoSeedSearcher::startSearch(const std::vector<u32> &seeds)
@@ -130,32 +105,27 @@ void ColoSeedSearcher::startSearch(const std::vector<u32> &seeds)
         progress++;
     }
 
-    std::sort(results.begin(), results.end());
-    results.erase(std::unique(results.begin(), results.end()), results.end());
+    RadixSort::sortUnique(results);
 }
 
-void ColoSeedSearcher::search(u32 start, u32 end)
+bool ColoSeedSearcher::search(u32 low, std::vector<u32> &seeds)
 {
-    std::vector<u32> seeds;
-    for (u32 low = start; low < end; low++, progress++)
+    for (u32 high = criteria.lead; high < 0x10000; high += 8)
     {
-        for (u32 high = criteria.lead; high < 0x10000; high += 8)
+        if (!searching)
         {
-            if (!searching)
-            {
-                return;
-            }
+            return false;
+        }
 
-            XDRNG rng((high << 16) | low);
-            if (searchSeedSkip(rng))
-            {
-                seeds.emplace_back(rng.getSeed());
-            }
+        XDRNG rng((high << 16) | low);
+        if (searchSeedSkip(rng))
+        {
+            seeds.emplace_back(rng.getSeed());
         }
     }
 
-    std::lock_guard<std::mutex> lock(mutex);
-    results.insert(results.end(), seeds.begin(), seeds.end());
+    progress++;
+    return true;
 }
 
 bool ColoSeedSearcher::searchSeed(XDRNG &rng) const
@@ -18,9 +18,8 @@
  */
 
 #include "GalesSeedSearcher.hpp"
-#include <algorithm>
+#include <Core/Util/RadixSort.hpp>
 #include <cstring>
-#include <thread>
 
 constexpr u16 enemyHPStat[5][2] = { { 290, 310 }, { 290, 270 }, { 290, 250 }, { 320, 270 }, { 270, 230 } };
 
@@ -113,33 +112,9 @@ GalesSeedSearcher::GalesSeedSearcher(const GalesCriteria &criteria) : SeedSearch
 
 void GalesSeedSearcher::startSearch(int threads)
 {
-    searching = true;
-
-    auto *threadContainer = new std::thread[threads];
-
-    u32 split = 0x10000 / threads;
-    u32 start = 0;
-    for (int i = 0; i < threads; i++, start += split)
-    {
-        if (i == threads - 1)
-        {
-            threadContainer[i] = std::thread([=] { search(start, 0x10000); });
-        }
-        else
-        {
-            threadContainer[i] = std::thread([=] { search(start, start + split); });
-        }
-    }
-
-    for (int i = 0; i < threads; i++)
-    {
-        threadContainer[i].join();
-    }
-
-    delete[] threadContainer;
+    searchUnits(threads, 0, 0x10000, 1, [this](u32 low, std::vector<u32> &seeds) { return search(low, seeds); });
 
-    std::sort(results.begin(), results.end());
-    results.erase(std::unique(results.begin(), results.end()), results.end());
+    RadixSort::sortUnique(results, threads);
 }
 
 void GalesSeedSearcher::startSearch(const std::vector<u32> &seeds)
@@ -162,32 +137,27 @@ void GalesSeedSearcher::startSearch(const std::vector<u32> &seeds)
         progress++;
     }
 
-    std::sort(results.begin(), results.end());
-    results.erase(std::unique(results.begin(), results.end()), results.end());
+    RadixSort::sortUnique(results);
 }
 
-void GalesSeedSearcher::search(u32 start, u32 end)
+bool GalesSeedSearcher::search(u32 low, std::vector<u32> &seeds)
 {
-    std::vector<u32> seeds;
-    for (u32 low = start; low < end; low++, progress++)
+    for (u32 high = criteria.playerIndex; high < 0x10000; high += 5)
     {
-        for (u32 high = criteria.playerIndex; high < 0x10000; high += 5)
+        if (!searching)
         {
-            if (!searching)
-            {
-                return;
-            }
+            return false;
+        }
 
-            XDRNG rng((high << 16) | low);
-            if (searchSeedSkip(rng))
-            {
-                seeds.emplace_back(rng.getSeed());
-            }
+        XDRNG rng((high << 16) | low);
+        if (searchSeedSkip(rng))
+        {
+            seeds.emplace_back(rng.getSeed());
         }
     }
 
-    std::lock_guard<std::mutex> lock(mutex);
-    results.insert(results.end(), seeds.begin(), seeds.end());
+    progress++;
+    return true;
 }
 
 bool GalesSeedSearcher::searchSeed(XDRNG &rng) const
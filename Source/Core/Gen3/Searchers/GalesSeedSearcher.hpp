@@ -61,12 +61,15 @@ public:
 
 private:
     /**
-     * @brief Searches over a range of PRNG states for valid candidate seeds
+     * @brief Searches a work unit of PRNG states for valid candidate seeds
      *
-     * @param start Lower PRNG state
-     * @param end Upper PRNG state
+     * @param low Lower 16 bits of the PRNG states
+     * @param seeds Vector to store valid candidate seeds in
+     *
+     * @return true Work unit was completed
+     * @return false Search was cancelled
      */
-    void search(u32 start, u32 end);
+    bool search(u32 low, std::vector<u32> &seeds);
 
     /**
      * @brief Determines if PRNG state is valid for the criteria
@@ -144,27 +144,36 @@ void GameCubeSearcher::startSearch(const std::array<u8, 6> &min, const std::arra
                 {
                     for (u8 spd = min[4]; spd <= max[4]; spd++)
                     {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        if (!searching)
                         {
-                            if (!searching)
-                            {
-                                return;
-                            }
+                            return;
+                        }
+
+                        u32 seeds[6 * 32];
+                        int offsets[33];
+                        LCRNGReverse::recoverXDRNGIV(hp, atk, def, spa, spd, min[5], max[5], seeds, offsets);
 
+                        std::vector<SearcherState> tile;
+                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        {
+                            int i = spe - min[5];
                             std::vector<SearcherState> states;
                             if ((profile.getVersion() & Game::Colosseum) != Game::None)
                             {
-                                states = searchColoShadow(hp, atk, def, spa, spd, spe, shadowTemplate);
+                                states = searchColoShadow(hp, atk, def, spa, spd, spe, seeds + offsets[i], offsets[i + 1] - offsets[i],
+                                                          shadowTemplate);
                             }
                             else
                             {
-                                states = searchGalesShadow(hp, atk, def, spa, spd, spe, shadowTemplate);
+                                states = searchGalesShadow(hp, atk, def, spa, spd, spe, seeds + offsets[i], offsets[i + 1] - offsets[i],
+                                                           shadowTemplate);
                             }
-
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
+                            tile.insert(tile.end(), states.begin(), states.end());
                         }
+
+                        auto guard = lockResults();
+                        results.insert(results.end(), tile.begin(), tile.end());
+                        progress += max[5] - min[5] + 1;
                     }
                 }
             }
@@ -203,19 +212,27 @@ void GameCubeSearcher::startSearch(const std::array<u8, 6> &min, const std::arra
                 {
                     for (u8 spd = min[4]; spd <= max[4]; spd++)
                     {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        if (!searching)
                         {
-                            if (!searching)
-                            {
-                                return;
-                            }
+                            return;
+                        }
 
-                            auto states = searchNonLock(hp, atk, def, spa, spd, spe, staticTemplate);
+                        u32 seeds[6 * 32];
+                        int offsets[33];
+                        LCRNGReverse::recoverXDRNGIV(hp, atk, def, spa, spd, min[5], max[5], seeds, offsets);
 
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
+                        std::vector<SearcherState> tile;
+                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        {
+                            int i = spe - min[5];
+                            auto states = searchNonLock(hp, atk, def, spa, spd, spe, seeds + offsets[i], offsets[i + 1] - offsets[i],
+                                                        staticTemplate);
+                            tile.insert(tile.end(), states.begin(), states.end());
                         }
+
+                        auto guard = lockResults();
+                        results.insert(results.end(), tile.begin(), tile.end());
+                        progress += max[5] - min[5] + 1;
                     }
                 }
             }
@@ -232,11 +249,16 @@ void GameCubeSearcher::searchChannel(u8 minSpd, u8 maxSpd, const StaticTemplate3
         u32 lower = spd << 27;
         u32 upper = lower | 0x7ffffff;
 
-        for (u64 seed = lower; seed <= upper; seed++, progress++)
+        for (u64 seed = lower; seed <= upper; seed++)
         {
-            if (!searching)
+            // Progress is counted a block of 0x10000 seeds at a time
+            if ((seed & 0xffff) == 0)
             {
-                return;
+                if (!searching)
+                {
+                    return;
+                }
+                progress += 0x10000;
             }
 
             XDRNGR rng(seed);
@@ -284,14 +306,14 @@ void GameCubeSearcher::searchChannel(u8 minSpd, u8 maxSpd, const StaticTemplate3
                                 info);
             if (filter.compareState(static_cast<const SearcherState &>(state)))
             {
-                std::lock_guard<std::mutex> guard(mutex);
+                auto guard = lockResults();
                 results.emplace_back(state);
             }
         }
     }
 }
 
-std::vector<SearcherState> GameCubeSearcher::searchColoShadow(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState> GameCubeSearcher::searchColoShadow(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
                                                               const ShadowTemplate *shadowTemplate)
 {
     std::vector<SearcherState> states;
@@ -307,8 +329,6 @@ std::vector<SearcherState> GameCubeSearcher::searchColoShadow(u8 hp, u8 atk, u8
         ivs = { hp, atk, def, spa, spd, spe };
     }
 
-    u32 seeds[6];
-    int size = LCRNGReverse::recoverXDRNGIV(hp, atk, def, spa, spd, spe, seeds);
     for (int i = 0; i < size; i++)
     {
         XDRNG rng(seeds[i]);
@@ -357,15 +377,13 @@ std::vector<SearcherState> GameCubeSearcher::searchColoShadow(u8 hp, u8 atk, u8
     return states;
 }
 
-std::vector<SearcherState> GameCubeSearcher::searchGalesShadow(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState> GameCubeSearcher::searchGalesShadow(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
                                                                const ShadowTemplate *shadowTemplate)
 {
     std::vector<SearcherState> states;
     const PersonalInfo *info = shadowTemplate->getInfo();
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
 
-    u32 seeds[6];
-    int size = LCRNGReverse::recoverXDRNGIV(hp, atk, def, spa, spd, spe, seeds);
     for (int i = 0; i < size; i++)
     {
         XDRNG rng(seeds[i]);
@@ -439,15 +457,13 @@ std::vector<SearcherState> GameCubeSearcher::searchGalesShadow(u8 hp, u8 atk, u8
     return states;
 }
 
-std::vector<SearcherState> GameCubeSearcher::searchNonLock(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState> GameCubeSearcher::searchNonLock(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
                                                            const StaticTemplate3 *staticTemplate)
 {
     std::vector<SearcherState> states;
     const PersonalInfo *info = staticTemplate->getInfo();
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
 
-    u32 seeds[6];
-    int size = LCRNGReverse::recoverXDRNGIV(hp, atk, def, spa, spd, spe, seeds);
     for (int i = 0; i < size; i++)
     {
         XDRNG rng(seeds[i]);
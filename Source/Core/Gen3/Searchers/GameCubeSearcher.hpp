@@ -81,11 +81,14 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      * @param shadowTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState> searchColoShadow(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const ShadowTemplate *shadowTemplate);
+    std::vector<SearcherState> searchColoShadow(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
+                                                const ShadowTemplate *shadowTemplate);
 
     /**
      * @brief Searches for matching states from provided IVs
@@ -96,11 +99,14 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      * @param shadowTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState> searchGalesShadow(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const ShadowTemplate *shadowTemplate);
+    std::vector<SearcherState> searchGalesShadow(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
+                                                 const ShadowTemplate *shadowTemplate);
 
     /**
      * @brief Searches for matching states from provided IVs
@@ -111,11 +117,14 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      * @param staticTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState> searchNonLock(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const StaticTemplate3 *staticTemplate);
+    std::vector<SearcherState> searchNonLock(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
+                                             const StaticTemplate3 *staticTemplate);
 };
 
 #endif // GAMECUBESEARCHER_HPP
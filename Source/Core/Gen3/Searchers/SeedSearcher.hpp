@@ -21,8 +21,18 @@
 #define SEEDSEARCHER_HPP
 
 #include <Core/Global.hpp>
+#include <Core/Parents/Searchers/SearchCheckpoint.hpp>
 #include <Core/Parents/Searchers/Searcher.hpp>
+#include <algorithm>
+#include <thread>
+#include <type_traits>
 
+/**
+ * @brief Parent seed searcher class that splits the search into 0x10000 work units that can be checkpointed, resumed and
+ * divided between machines
+ *
+ * @tparam Criteria Filtering data
+ */
 template <class Criteria>
 class SeedSearcher : public SearcherBase<u32>
 {
@@ -32,12 +42,132 @@ public:
      *
      * @param criteria Filtering data
      */
-    SeedSearcher(const Criteria &criteria) : criteria(criteria)
+    SeedSearcher(const Criteria &criteria) : criteria(criteria), checkpoint(0x10000), interval(0), first(0), last(0x10000)
+    {
+    }
+
+    /**
+     * @brief Enables saving the search progress to a file. If the file holds progress of a previous search with the same
+     * criteria the search resumes from it.
+     *
+     * @param path Checkpoint file
+     * @param interval Number of completed work units between saves
+     *
+     * @return true Previous progress was resumed
+     * @return false Search starts from the beginning
+     */
+    bool setCheckpoint(const std::string &path, u32 interval = 256)
     {
+        this->path = path;
+        this->interval = interval;
+        return checkpoint.load(path, getKey());
+    }
+
+    /**
+     * @brief Limits the search to a range of work units so a search can be split between machines
+     *
+     * @param first First work unit
+     * @param last Last work unit (exclusive)
+     */
+    void setRange(u32 first, u32 last)
+    {
+        this->first = first;
+        this->last = std::min(last, 0x10000u);
     }
 
 protected:
     Criteria criteria;
+
+    /**
+     * @brief Runs the work units of the search across threads, skipping units that are already complete
+     *
+     * @param threads Number of threads to search with
+     * @param begin First work unit of the search
+     * @param end Last work unit of the search (exclusive)
+     * @param weight Progress of a single work unit
+     * @param function Searches a work unit, returning false if the search was cancelled
+     */
+    template <class Function>
+    void searchUnits(int threads, u32 begin, u32 end, u32 weight, Function function)
+    {
+        searching = true;
+        results = checkpoint.getResults<u32>();
+
+        std::atomic<u32> next = std::max(begin, first);
+        end = std::min(end, last);
+
+        auto worker = [&] {
+            SearchTelemetry::ThreadTimer timer(telemetry.get());
+            std::vector<u32> seeds;
+            for (u32 unit = next++; unit < end; unit = next++)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (checkpoint.isComplete(unit))
+                    {
+                        progress += weight;
+                        continue;
+                    }
+                }
+
+                seeds.clear();
+                if (!function(unit, seeds))
+                {
+                    return;
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                checkpoint.complete(unit, seeds);
+                results.insert(results.end(), seeds.begin(), seeds.end());
+                if (!path.empty() && checkpoint.isDirty(interval))
+                {
+                    checkpoint.save(path, getKey());
+                }
+            }
+        };
+
+        auto *threadContainer = new std::thread[threads];
+        for (int i = 0; i < threads; i++)
+        {
+            threadContainer[i] = std::thread(worker);
+        }
+
+        for (int i = 0; i < threads; i++)
+        {
+            threadContainer[i].join();
+        }
+
+        delete[] threadContainer;
+
+        if (!path.empty())
+        {
+            checkpoint.save(path, getKey());
+        }
+    }
+
+private:
+    SearchCheckpoint checkpoint;
+    std::string path;
+    u32 interval;
+    u32 first;
+    u32 last;
+
+    /**
+     * @brief Computes the identifier of the criteria so checkpoints of a different search are not resumed
+     *
+     * @return Criteria identifier
+     */
+    u64 getKey() const
+    {
+        if constexpr (std::has_unique_object_representations_v<Criteria>)
+        {
+            return SearchCheckpoint::hash(&criteria, sizeof(Criteria)) ^ sizeof(Criteria);
+        }
+        else
+        {
+            return SearchCheckpoint::hash(criteria.data(), criteria.size() * sizeof(typename Criteria::value_type)) ^ sizeof(Criteria);
+        }
+    }
 };
 
 #endif // SEEDSEARCHER_HPP
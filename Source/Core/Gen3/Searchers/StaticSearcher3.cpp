@@ -46,19 +46,27 @@ void StaticSearcher3::startSearch(const std::array<u8, 6> &min, const std::array
                 {
                     for (u8 spd = min[4]; spd <= max[4]; spd++)
                     {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        if (!searching)
                         {
-                            if (!searching)
-                            {
-                                return;
-                            }
+                            return;
+                        }
 
-                            auto states = search(hp, atk, def, spa, spd, spe, staticTemplate);
+                        u32 seeds[6 * 32];
+                        int offsets[33];
+                        LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, min[5], max[5], seeds, offsets, method);
 
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
+                        std::vector<SearcherState> tile;
+                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        {
+                            int i = spe - min[5];
+                            auto states = search(hp, atk, def, spa, spd, spe, seeds + offsets[i], offsets[i + 1] - offsets[i],
+                                                 staticTemplate);
+                            tile.insert(tile.end(), states.begin(), states.end());
                         }
+
+                        auto guard = lockResults();
+                        results.insert(results.end(), tile.begin(), tile.end());
+                        progress += max[5] - min[5] + 1;
                     }
                 }
             }
@@ -66,7 +74,7 @@ void StaticSearcher3::startSearch(const std::array<u8, 6> &min, const std::array
     }
 }
 
-std::vector<SearcherState> StaticSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState> StaticSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
                                                    const StaticTemplate3 *staticTemplate) const
 {
     std::vector<SearcherState> states;
@@ -80,8 +88,6 @@ std::vector<SearcherState> StaticSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa
     }
     const PersonalInfo *info = staticTemplate->getInfo();
 
-    u32 seeds[6];
-    int size = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, seeds, method);
     for (int i = 0; i < size; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -62,11 +62,14 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      * @param staticTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const StaticTemplate3 *staticTemplate) const;
+    std::vector<SearcherState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
+                                      const StaticTemplate3 *staticTemplate) const;
 };
 
 #endif // STATICSEARCHER3_HPP
@@ -30,6 +30,7 @@
 #include <Core/RNG/LCRNGReverse.hpp>
 #include <Core/Util/EncounterSlot.hpp>
 #include <Core/Util/Utilities.hpp>
+#include <cassert>
 
 constexpr u8 feebasSlots[] = { 2, 3, 5 };
 
@@ -53,6 +54,12 @@ static bool cuteCharmGender(const PersonalInfo *info, u32 pid, Lead lead)
     }
 }
 
+static Lead firstLead(const std::vector<Lead> &leads)
+{
+    assert(!leads.empty());
+    return leads.front();
+}
+
 static u8 unownLetter(u32 pid)
 {
     return (((pid & 0x3000000) >> 18) | ((pid & 0x30000) >> 12) | ((pid & 0x300) >> 6) | (pid & 0x3)) % 0x1c;
@@ -60,12 +67,23 @@ static u8 unownLetter(u32 pid)
 
 WildSearcher3::WildSearcher3(Method method, Lead lead, bool feebasTile, const EncounterArea3 &area, const Profile3 &profile,
                              const WildStateFilter &filter) :
-    WildSearcher(method, lead, area, profile, filter),
+    WildSearcher3(method, std::vector<Lead> { lead }, feebasTile, area, profile, filter)
+{
+}
+
+WildSearcher3::WildSearcher3(Method method, const std::vector<Lead> &leads, bool feebasTile, const EncounterArea3 &area,
+                             const Profile3 &profile, const WildStateFilter &filter) :
+    WildSearcher(method, firstLead(leads), area, profile, filter),
     ivAdvance(method == Method::Method2),
     feebasTile(feebasTile),
     rate(0),
-    modifiedSlots(area.getSlots(lead))
+    leads(leads)
 {
+    for (Lead lead : leads)
+    {
+        modifiedSlots.emplace_back(area.getSlots(lead));
+    }
+
     if ((profile.getVersion() & Game::RSE) != Game::None && area.getEncounter() == Encounter::RockSmash)
     {
         rate = area.getRate() * 16;
@@ -92,19 +110,27 @@ void WildSearcher3::startSearch(const std::array<u8, 6> &min, const std::array<u
                 {
                     for (u8 spd = min[4]; spd <= max[4]; spd++)
                     {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        if (!searching)
                         {
-                            if (!searching)
-                            {
-                                return;
-                            }
+                            return;
+                        }
 
-                            auto states = search(hp, atk, def, spa, spd, spe, feebas, safari, tanoby);
+                        u32 seeds[6 * 32];
+                        int offsets[33];
+                        LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, min[5], max[5], seeds, offsets, method);
 
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
+                        std::vector<WildSearcherState> tile;
+                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        {
+                            int i = spe - min[5];
+                            auto states = search(hp, atk, def, spa, spd, spe, seeds + offsets[i], offsets[i + 1] - offsets[i], feebas,
+                                                 safari, tanoby);
+                            tile.insert(tile.end(), states.begin(), states.end());
                         }
+
+                        auto guard = lockResults();
+                        results.insert(results.end(), tile.begin(), tile.end());
+                        progress += max[5] - min[5] + 1;
                     }
                 }
             }
@@ -112,14 +138,12 @@ void WildSearcher3::startSearch(const std::array<u8, 6> &min, const std::array<u
     }
 }
 
-std::vector<WildSearcherState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, bool feebas, bool safari,
-                                                     bool tanoby) const
+std::vector<WildSearcherState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size, bool feebas,
+                                                     bool safari, bool tanoby) const
 {
     std::vector<WildSearcherState> states;
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
 
-    u32 seeds[6];
-    int size = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, seeds, method);
     for (int i = 0; i < size; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -154,259 +178,264 @@ std::vector<WildSearcherState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 s
 
         do
         {
-            bool cuteCharmFlag = false;
-            u8 encounterSlot[4];
-            bool force = false;
-            u16 levelRand[2];
-            PokeRNGR test[4] = { rng, rng, rng, rng };
-            bool valid[4] = { false, false, false, false };
-
-            switch (lead)
+            // The walk back to the previous nature match is shared by every lead
+            for (size_t j = 0; j < leads.size(); j++)
             {
-            case Lead::None:
-                if (tanoby)
+                Lead lead = leads[j];
+                bool cuteCharmFlag = false;
+                u8 encounterSlot[4];
+                bool force = false;
+                u16 levelRand[2];
+                PokeRNGR test[4] = { rng, rng, rng, rng };
+                bool valid[4] = { false, false, false, false };
+
+                switch (lead)
                 {
-                    levelRand[0] = nextRNG;
-                    encounterSlot[0] = EncounterSlot::hSlot(nextRNG2 % 100, area.getEncounter());
-                    valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
-                }
-                else if ((nextRNG % 25) == nature)
-                {
-                    levelRand[0] = safari ? test[0].nextUShort() : nextRNG2;
-
-                    if (feebas)
+                case Lead::None:
+                    if (tanoby)
                     {
-                        if (feebasTile)
+                        levelRand[0] = nextRNG;
+                        encounterSlot[0] = EncounterSlot::hSlot(nextRNG2 % 100, area.getEncounter());
+                        valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
+                    }
+                    else if ((nextRNG % 25) == nature)
+                    {
+                        levelRand[0] = safari ? test[0].nextUShort() : nextRNG2;
+
+                        if (feebas)
                         {
-                            if (test[0].nextUShort(100) < 50)
+                            if (feebasTile)
                             {
-                                encounterSlot[0] = feebasSlots[toInt(area.getEncounter() - Encounter::OldRod)];
-                                valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
+                                if (test[0].nextUShort(100) < 50)
+                                {
+                                    encounterSlot[0] = feebasSlots[toInt(area.getEncounter() - Encounter::OldRod)];
+                                    valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
+                                }
+
+                                u8 rand = test[1].nextUShort(100);
+                                if (test[1].nextUShort(100) >= 50)
+                                {
+                                    encounterSlot[1] = EncounterSlot::hSlot(rand, area.getEncounter());
+                                    valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
+                                }
                             }
-
-                            u8 rand = test[1].nextUShort(100);
-                            if (test[1].nextUShort(100) >= 50)
+                            else
                             {
-                                encounterSlot[1] = EncounterSlot::hSlot(rand, area.getEncounter());
-                                valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
+                                test[0].advance(1);
+                                encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
+                                valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                             }
                         }
                         else
                         {
-                            test[0].advance(1);
                             encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
                             valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                         }
                     }
-                    else
-                    {
-                        encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
-                        valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
-                    }
-                }
-                break;
-            case Lead::CuteCharmF:
-            case Lead::CuteCharmM:
-                if ((nextRNG % 25) == nature)
-                {
-                    cuteCharmFlag = (nextRNG2 % 3) > 0;
-                    if (safari)
+                    break;
+                case Lead::CuteCharmF:
+                case Lead::CuteCharmM:
+                    if ((nextRNG % 25) == nature)
                     {
-                        test[0].next();
-                    }
-                    levelRand[0] = test[0].nextUShort();
+                        cuteCharmFlag = (nextRNG2 % 3) > 0;
+                        if (safari)
+                        {
+                            test[0].next();
+                        }
+                        levelRand[0] = test[0].nextUShort();
 
-                    if (feebas)
-                    {
-                        if (feebasTile)
+                        if (feebas)
                         {
-                            if (test[0].nextUShort(100) < 50)
+                            if (feebasTile)
                             {
-                                encounterSlot[0] = feebasSlots[toInt(area.getEncounter() - Encounter::OldRod)];
-                                valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
+                                if (test[0].nextUShort(100) < 50)
+                                {
+                                    encounterSlot[0] = feebasSlots[toInt(area.getEncounter() - Encounter::OldRod)];
+                                    valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
+                                }
+
+                                u8 rand = test[1].nextUShort(100);
+                                if (test[1].nextUShort(100) >= 50)
+                                {
+                                    encounterSlot[1] = EncounterSlot::hSlot(rand, area.getEncounter());
+                                    valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
+                                }
                             }
-
-                            u8 rand = test[1].nextUShort(100);
-                            if (test[1].nextUShort(100) >= 50)
+                            else
                             {
-                                encounterSlot[1] = EncounterSlot::hSlot(rand, area.getEncounter());
-                                valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
+                                test[0].advance(1);
+                                encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
+                                valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                             }
                         }
                         else
                         {
-                            test[0].advance(1);
                             encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
                             valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                         }
                     }
-                    else
+                    break;
+                case Lead::Synchronize:
+                    if ((nextRNG & 1) == 0)
                     {
-                        encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
-                        valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
-                    }
-                }
-                break;
-            case Lead::Synchronize:
-                if ((nextRNG & 1) == 0)
-                {
-                    levelRand[0] = safari ? test[0].nextUShort() : nextRNG2;
+                        levelRand[0] = safari ? test[0].nextUShort() : nextRNG2;
 
-                    if (feebas)
-                    {
-                        if (feebasTile)
+                        if (feebas)
                         {
-                            if (test[0].nextUShort(100) < 50)
+                            if (feebasTile)
                             {
-                                encounterSlot[0] = feebasSlots[toInt(area.getEncounter() - Encounter::OldRod)];
-                                valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
+                                if (test[0].nextUShort(100) < 50)
+                                {
+                                    encounterSlot[0] = feebasSlots[toInt(area.getEncounter() - Encounter::OldRod)];
+                                    valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
+                                }
+
+                                u8 rand = test[1].nextUShort(100);
+                                if (test[1].nextUShort(100) >= 50)
+                                {
+                                    encounterSlot[1] = EncounterSlot::hSlot(rand, area.getEncounter());
+                                    valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
+                                }
                             }
-
-                            u8 rand = test[1].nextUShort(100);
-                            if (test[1].nextUShort(100) >= 50)
+                            else
                             {
-                                encounterSlot[1] = EncounterSlot::hSlot(rand, area.getEncounter());
-                                valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
+                                test[0].advance(1);
+                                encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
+                                valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                             }
                         }
                         else
                         {
-                            test[0].advance(1);
                             encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
                             valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                         }
                     }
-                    else
-                    {
-                        encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
-                        valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
-                    }
-                }
 
-                if ((nextRNG2 & 1) == 1 && (nextRNG % 25) == nature)
-                {
-                    if (safari)
+                    if ((nextRNG2 & 1) == 1 && (nextRNG % 25) == nature)
                     {
-                        test[1].next();
-                    }
-                    levelRand[1] = test[2].nextUShort();
+                        if (safari)
+                        {
+                            test[1].next();
+                        }
+                        levelRand[1] = test[2].nextUShort();
 
-                    if (feebas)
-                    {
-                        if (feebasTile)
+                        if (feebas)
                         {
-                            if (test[2].nextUShort(100) < 50)
+                            if (feebasTile)
                             {
-                                encounterSlot[2] = feebasSlots[toInt(area.getEncounter() - Encounter::OldRod)];
-                                valid[2] = filter.compareEncounterSlot(encounterSlot[2]);
+                                if (test[2].nextUShort(100) < 50)
+                                {
+                                    encounterSlot[2] = feebasSlots[toInt(area.getEncounter() - Encounter::OldRod)];
+                                    valid[2] = filter.compareEncounterSlot(encounterSlot[2]);
+                                }
+
+                                test[3].advance(1);
+                                u8 rand = test[3].nextUShort(100);
+                                if (test[3].nextUShort(100) >= 50)
+                                {
+                                    encounterSlot[3] = EncounterSlot::hSlot(rand, area.getEncounter());
+                                    valid[3] = filter.compareEncounterSlot(encounterSlot[3]);
+                                }
                             }
-
-                            test[3].advance(1);
-                            u8 rand = test[3].nextUShort(100);
-                            if (test[3].nextUShort(100) >= 50)
+                            else
                             {
-                                encounterSlot[3] = EncounterSlot::hSlot(rand, area.getEncounter());
-                                valid[3] = filter.compareEncounterSlot(encounterSlot[3]);
+                                test[2].advance(1);
+                                encounterSlot[2] = EncounterSlot::hSlot(test[2].nextUShort(100), area.getEncounter());
+                                valid[2] = filter.compareEncounterSlot(encounterSlot[2]);
                             }
                         }
                         else
                         {
-                            test[2].advance(1);
                             encounterSlot[2] = EncounterSlot::hSlot(test[2].nextUShort(100), area.getEncounter());
                             valid[2] = filter.compareEncounterSlot(encounterSlot[2]);
                         }
                     }
-                    else
-                    {
-                        encounterSlot[2] = EncounterSlot::hSlot(test[2].nextUShort(100), area.getEncounter());
-                        valid[2] = filter.compareEncounterSlot(encounterSlot[2]);
-                    }
-                }
-                break;
-            case Lead::MagnetPull:
-            case Lead::Static:
-                // Not possible to use this lead for fishing so skip the Feebas logic
-                if ((nextRNG % 25) == nature)
-                {
-                    levelRand[0] = safari ? test[0].nextUShort() : nextRNG2;
-                    u16 encounterRand = test[0].nextUShort();
-                    if (test[0].nextUShort(2) == 0 && !modifiedSlots.empty())
+                    break;
+                case Lead::MagnetPull:
+                case Lead::Static:
+                    // Not possible to use this lead for fishing so skip the Feebas logic
+                    if ((nextRNG % 25) == nature)
                     {
-                        encounterSlot[0] = modifiedSlots[encounterRand];
+                        levelRand[0] = safari ? test[0].nextUShort() : nextRNG2;
+                        u16 encounterRand = test[0].nextUShort();
+                        if (test[0].nextUShort(2) == 0 && !modifiedSlots[j].empty())
+                        {
+                            encounterSlot[0] = modifiedSlots[j][encounterRand];
+                        }
+                        else
+                        {
+                            encounterSlot[0] = EncounterSlot::hSlot(encounterRand % 100, area.getEncounter());
+                        }
+                        valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                     }
-                    else
+                    break;
+                case Lead::Pressure:
+                    if ((nextRNG % 25) == nature)
                     {
-                        encounterSlot[0] = EncounterSlot::hSlot(encounterRand % 100, area.getEncounter());
-                    }
-                    valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
-                }
-                break;
-            case Lead::Pressure:
-                if ((nextRNG % 25) == nature)
-                {
-                    force = ((safari ? test[0].nextUShort() : nextRNG2) & 1) == 0;
-                    levelRand[0] = test[0].nextUShort();
+                        force = ((safari ? test[0].nextUShort() : nextRNG2) & 1) == 0;
+                        levelRand[0] = test[0].nextUShort();
 
-                    if (feebas)
-                    {
-                        if (feebasTile)
+                        if (feebas)
                         {
-                            if (test[0].nextUShort(100) < 50)
+                            if (feebasTile)
                             {
-                                encounterSlot[0] = feebasSlots[toInt(area.getEncounter() - Encounter::OldRod)];
-                                valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
+                                if (test[0].nextUShort(100) < 50)
+                                {
+                                    encounterSlot[0] = feebasSlots[toInt(area.getEncounter() - Encounter::OldRod)];
+                                    valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
+                                }
+
+                                u8 rand = test[1].nextUShort(100);
+                                if (test[1].nextUShort(100) >= 50)
+                                {
+                                    encounterSlot[1] = EncounterSlot::hSlot(rand, area.getEncounter());
+                                    valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
+                                }
                             }
-
-                            u8 rand = test[1].nextUShort(100);
-                            if (test[1].nextUShort(100) >= 50)
+                            else
                             {
-                                encounterSlot[1] = EncounterSlot::hSlot(rand, area.getEncounter());
-                                valid[1] = filter.compareEncounterSlot(encounterSlot[1]);
+                                test[0].advance(1);
+                                encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
+                                valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                             }
                         }
                         else
                         {
-                            test[0].advance(1);
                             encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
                             valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
                         }
                     }
-                    else
-                    {
-                        encounterSlot[0] = EncounterSlot::hSlot(test[0].nextUShort(100), area.getEncounter());
-                        valid[0] = filter.compareEncounterSlot(encounterSlot[0]);
-                    }
+                    break;
+                default:
+                    break;
                 }
-                break;
-            default:
-                break;
-            }
 
-            for (int i = 0; i < 4; i++)
-            {
-                if (valid[i] && (rate == 0 || (test[i].nextUShort(2880) < rate)))
+                for (int i = 0; i < 4; i++)
                 {
-                    const Slot &slot = area.getPokemon(encounterSlot[i]);
-                    const PersonalInfo *info = slot.getInfo();
-                    if ((!cuteCharmFlag || cuteCharmGender(info, pid, lead))
-                        && (slot.getSpecie() != 201 || unownLetter(pid) == slot.getForm()))
+                    if (valid[i] && (rate == 0 || (test[i].nextUShort(2880) < rate)))
                     {
-                        u8 level;
-                        if (lead == Lead::Pressure)
-                        {
-                            level = area.calculateLevel(encounterSlot[i], levelRand[i >> 1], force);
-                        }
-                        else
+                        const Slot &slot = area.getPokemon(encounterSlot[i]);
+                        const PersonalInfo *info = slot.getInfo();
+                        if ((!cuteCharmFlag || cuteCharmGender(info, pid, lead))
+                            && (slot.getSpecie() != 201 || unownLetter(pid) == slot.getForm()))
                         {
-                            level = area.EncounterArea::calculateLevel(encounterSlot[i], levelRand[i >> 1]);
-                        }
+                            u8 level;
+                            if (lead == Lead::Pressure)
+                            {
+                                level = area.calculateLevel(encounterSlot[i], levelRand[i >> 1], force);
+                            }
+                            else
+                            {
+                                level = area.EncounterArea::calculateLevel(encounterSlot[i], levelRand[i >> 1]);
+                            }
 
-                        WildSearcherState state(test[i].next(), pid, ivs, pid & 1, Utilities::getGender(pid, info), level, nature,
-                                                Utilities::getShiny<true>(pid, tsv), encounterSlot[i], 0, slot.getSpecie(), slot.getForm(),
-                                                info);
-                        if (filter.compareState(state))
-                        {
-                            states.emplace_back(state);
+                            WildSearcherState state(test[i].next(), lead, pid, ivs, pid & 1, Utilities::getGender(pid, info), level, nature,
+                                                    Utilities::getShiny<true>(pid, tsv), encounterSlot[i], 0, slot.getSpecie(),
+                                                    slot.getForm(), info);
+                            if (filter.compareState(state))
+                            {
+                                states.emplace_back(state);
+                            }
                         }
                     }
                 }
@@ -46,6 +46,20 @@ public:
     WildSearcher3(Method method, Lead lead, bool feebasTile, const EncounterArea3 &area, const Profile3 &profile,
                   const WildStateFilter &filter);
 
+    /**
+     * @brief Construct a new WildSearcher3 object that searches several leads at once.
+     * Each seed is only walked back once and the walk is checked against every lead.
+     *
+     * @param method Encounter method
+     * @param leads Encounter leads, needs at least one lead
+     * @param feebasTile Whether Feebas tiles are active
+     * @param area Wild pokemon info
+     * @param profile Profile Information
+     * @param filter State filter
+     */
+    WildSearcher3(Method method, const std::vector<Lead> &leads, bool feebasTile, const EncounterArea3 &area, const Profile3 &profile,
+                  const WildStateFilter &filter);
+
     /**
      * @brief Starts the search
      *
@@ -58,7 +72,8 @@ private:
     u16 rate;
     bool feebasTile;
     bool ivAdvance;
-    ModifiedSlots modifiedSlots;
+    std::vector<Lead> leads;
+    std::vector<ModifiedSlots> modifiedSlots;
 
     /**
      * @brief Searches for matching states from provided IVs
@@ -69,13 +84,16 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      * @param feebas Whether the encounter location contains Feebas
      * @param safari Whether the encounter location is the Safari Zone in RSE
      * @param tanoby Whether the encounter location is Tanoby Ruins in FRLG
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, bool feebas, bool safari, bool tanoby) const;
+    std::vector<WildSearcherState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size, bool feebas,
+                                          bool safari, bool tanoby) const;
 };
 
 #endif // WILDSEARCHER3_HPP
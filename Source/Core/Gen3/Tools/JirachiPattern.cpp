@@ -20,6 +20,7 @@
 #include "JirachiPattern.hpp"
 #include <Core/RNG/LCRNG.hpp>
 #include <algorithm>
+#include <array>
 
 /**
  * @brief Does the advance from playing the cutscene
@@ -82,37 +83,6 @@ static void advanceTitleScreen(XDRNG &rng, u32 &count)
     rng.advance(1, &count);
 }
 
-/**
- * @brief Advance the internal search actions for use in brute force searching
- *
- * @param actions Search actions
- */
-static void incrementSearchActions(std::vector<u8> &actions)
-{
-    size_t size = actions.size();
-
-    bool increment = true;
-    for (size_t i = 0; i < size; i++)
-    {
-        u8 compare = i == 0 ? 2 : 3;
-        if (actions[i] >= compare)
-        {
-            increment = false;
-
-            actions[i] = 0;
-            if (i != size - 1)
-            {
-                actions[i + 1]++;
-            }
-        }
-        else if (increment)
-        {
-            actions[i]++;
-            break;
-        }
-    }
-}
-
 /**
  * @brief Determines if target seed passes the menu advance pattern
  * Working backwards from a seed check if the menu sequence will end on said seed
@@ -151,12 +121,92 @@ static bool validateMenu(u32 seed)
     return true;
 }
 
+/**
+ * @brief Performs a brute force action from a menu
+ *
+ * @param rng PRNG state
+ * @param count Advance counter
+ * @param action Action to perform
+ */
+static void advanceAction(XDRNG &rng, u32 &count, u8 action)
+{
+    // Reload menu
+    if (action == 0)
+    {
+        advanceMenu(rng, count);
+    }
+    // Reject jirachi
+    else if (action == 1)
+    {
+        advanceJirachi(rng, count);
+        advanceTitleScreen(rng, count);
+        advanceMenu(rng, count);
+    }
+    // Special cutscene
+    else
+    {
+        advanceCutscene(rng, count);
+        advanceTitleScreen(rng, count);
+        advanceMenu(rng, count);
+    }
+}
+
+/**
+ * @brief Collects the action sequences that reach a final menu state in the fewest actions.
+ * Sequences are built backwards from the final states so they are produced ordered by their last action first.
+ *
+ * @param layers Menu states grouped by the number of actions needed to reach them
+ * @param next Menu state reached by each action from each menu state
+ * @param states Menu states reachable at the current depth that lead to a final state
+ * @param depth Number of actions needed to reach \p states
+ * @param suffix Actions taken after the current depth
+ * @param plans Vector to store action sequences in
+ * @param maxPlans Maximum number of action sequences to collect
+ */
+static void collectPlans(const std::vector<std::vector<u32>> &layers, const std::vector<std::array<u32, 3>> &next,
+                         const std::vector<u32> &states, u32 depth, std::vector<u8> &suffix, std::vector<std::vector<u8>> &plans,
+                         u32 maxPlans)
+{
+    if (depth == 0)
+    {
+        plans.emplace_back(suffix.rbegin(), suffix.rend());
+        return;
+    }
+
+    for (u8 action = 0; action < 3 && plans.size() < maxPlans; action++)
+    {
+        std::vector<u32> previous;
+        for (u32 state : layers[depth - 1])
+        {
+            if (std::binary_search(states.begin(), states.end(), next[state][action]))
+            {
+                previous.emplace_back(state);
+            }
+        }
+
+        if (!previous.empty())
+        {
+            std::sort(previous.begin(), previous.end());
+
+            suffix.emplace_back(action);
+            collectPlans(layers, next, previous, depth - 1, suffix, plans, maxPlans);
+            suffix.pop_back();
+        }
+    }
+}
+
 namespace JirachiPattern
 {
     std::vector<u8> calculateActions(u32 seed, u32 targetAdvance, u32 bruteForce)
+    {
+        auto plans = calculateActionPlans(seed, targetAdvance, bruteForce, 1);
+        return plans.empty() ? std::vector<u8>() : plans.front();
+    }
+
+    std::vector<std::vector<u8>> calculateActionPlans(u32 seed, u32 targetAdvance, u32 bruteForce, u32 maxPlans)
     {
         // Not possible
-        if (targetAdvance < 6)
+        if (targetAdvance < 6 || maxPlans == 0)
         {
             return {};
         }
@@ -170,7 +220,7 @@ namespace JirachiPattern
 
             if (count == targetAdvance)
             {
-                return { 255 };
+                return { { 255 } };
             }
         }
 
@@ -185,85 +235,85 @@ namespace JirachiPattern
             advanceMenu(menu, menuAdvance);
         }
 
-        // Search the brute force range
-        for (size_t i = 1;; i++)
+        // Add a buffer of 6 since that is the minimum accepting Jirachi can advance
+        if (menuAdvance + 6 > targetAdvance)
         {
-            // This variable handles checking if all of the possibilities of the current search size exceed the target seed
-            // This is preferred to guessing what value of 'i' that is
-            bool done = true;
+            return {};
+        }
 
-            std::vector<u8> searchActions(i, 0);
-            while (true)
-            {
-                u32 searchAdvance = menuAdvance;
-                XDRNG rng(menu);
+        // Menu states are identified by their advance offset from the brute force start and expanded breadth first so each
+        // one is visited once with the fewest actions needed to reach it
+        u32 size = targetAdvance - 6 - menuAdvance + 1;
+        std::vector<u32> depths(size, 0xffffffff);
+        std::vector<u32> seeds(size);
+        std::vector<std::array<u32, 3>> next(size);
+        std::vector<std::vector<u32>> layers;
 
-                bool flag = true;
-                for (u8 action : searchActions)
-                {
-                    // Reload menu
-                    if (action == 0)
-                    {
-                        advanceMenu(rng, searchAdvance);
-                    }
-                    // Reject jirachi
-                    else if (action == 1)
-                    {
-                        advanceJirachi(rng, searchAdvance);
-                        advanceTitleScreen(rng, searchAdvance);
-                        advanceMenu(rng, searchAdvance);
-                    }
-                    // Special cutscene
-                    else
-                    {
-                        advanceCutscene(rng, searchAdvance);
-                        advanceTitleScreen(rng, searchAdvance);
-                        advanceMenu(rng, searchAdvance);
-                    }
+        depths[0] = 0;
+        seeds[0] = menu.getSeed();
+        layers.emplace_back(1, 0);
 
-                    // Make sure we didn't go past the target
-                    // Add a buffer of 6 since that is the minimum accepting Jirachi can advance
-                    if (searchAdvance + 6 > targetAdvance)
+        std::vector<u32> finals;
+        for (u32 depth = 0; !layers[depth].empty(); depth++)
+        {
+            // Accepting from the starting state is only an option after using the menu advance
+            if (depth != 0 || menuCount != 0)
+            {
+                for (u32 state : layers[depth])
+                {
+                    XDRNG rng(seeds[state]);
+                    u32 count = menuAdvance + state;
+                    advanceJirachi(rng, count);
+                    if (count == targetAdvance)
                     {
-                        flag = false;
-                        break;
+                        finals.emplace_back(state);
                     }
                 }
+            }
 
-                // Check if accepting the Jirachi will land on the target
-                if (flag)
-                {
-                    done = false;
-
-                    // If we land on target seed then return the actions to get to it
-                    advanceJirachi(rng, searchAdvance);
-                    if (searchAdvance == targetAdvance)
-                    {
-                        // Vector is constructed in the way that the initial menu advances are already set
-                        std::vector<u8> actions(menuCount + searchActions.size() + 1, 0);
-
-                        // Copy over the search actions
-                        std::copy(searchActions.cbegin(), searchActions.cend(), actions.begin() + menuCount);
-
-                        actions[actions.size() - 1] = 3;
+            if (!finals.empty())
+            {
+                std::sort(finals.begin(), finals.end());
 
-                        return actions;
-                    }
-                }
+                std::vector<std::vector<u8>> plans;
+                std::vector<u8> suffix;
+                collectPlans(layers, next, finals, depth, suffix, plans, maxPlans);
 
-                // Exit loop once all possibilities have been attempted
-                if (std::count(searchActions.cbegin(), searchActions.cend(), 2) == i)
+                for (auto &plan : plans)
                 {
-                    break;
+                    // Prepend the initial menu advances and append accepting the Jirachi
+                    plan.insert(plan.begin(), menuCount, 0);
+                    plan.emplace_back(3);
                 }
-
-                incrementSearchActions(searchActions);
+                return plans;
             }
 
-            if (done)
+            std::vector<u32> layer;
+            for (u32 state : layers[depth])
             {
-                break;
+                for (u8 action = 0; action < 3; action++)
+                {
+                    XDRNG rng(seeds[state]);
+                    u32 count = menuAdvance + state;
+                    advanceAction(rng, count, action);
+
+                    u32 offset = count - menuAdvance;
+                    if (offset >= size)
+                    {
+                        next[state][action] = 0xffffffff;
+                        continue;
+                    }
+
+                    next[state][action] = offset;
+                    if (depths[offset] == 0xffffffff)
+                    {
+                        depths[offset] = depth + 1;
+                        seeds[offset] = rng.getSeed();
+                        layer.emplace_back(offset);
+                    }
+                }
             }
+            layers.emplace_back(std::move(layer));
         }
 
         // If we get to this point then it is extremely unlikely to get to the the target seed from the current seed
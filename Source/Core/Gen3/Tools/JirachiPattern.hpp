@@ -36,6 +36,18 @@ namespace JirachiPattern
      */
     std::vector<u8> calculateActions(u32 seed, u32 targetAdvance, u32 bruteForce);
 
+    /**
+     * @brief Calculates every series of actions with the fewest actions to take to hit the target seed
+     *
+     * @param seed Starting seed
+     * @param advance Target advance
+     * @param bruteForce What frame range to brute force actions over
+     * @param maxPlans Maximum number of series of actions to return
+     *
+     * @return List of series of actions to take to get the target Jirachi, ordered by preference
+     */
+    std::vector<std::vector<u8>> calculateActionPlans(u32 seed, u32 targetAdvance, u32 bruteForce, u32 maxPlans);
+
     /**
      * @brief Runs the menu and Jirachi pattern to get the PRNG state that would generate the Jirachi
      *
@@ -180,6 +180,26 @@ constexpr std::array<u16, 15> greatMarshPtDex = { 46, 102, 114, 115, 193, 195, 2
 constexpr std::array<u16, 16> trophyGardenDP = { 35, 39, 52, 113, 133, 137, 173, 174, 183, 298, 311, 312, 351, 438, 439, 440 };
 constexpr std::array<u16, 16> trophyGardenPt = { 35, 39, 52, 113, 132, 133, 173, 174, 183, 298, 311, 312, 351, 438, 439, 440 };
 
+/**
+ * @brief Decompresses the embedded encounter table on first use and keeps it for the lifetime of the program
+ *
+ * @tparam compressed Compressed encounter table
+ *
+ * @return Decompressed encounter table
+ */
+template <const auto &compressed>
+static const std::vector<u8> &getTable()
+{
+    static const std::vector<u8> table = [] {
+        u32 length;
+        u8 *data = Utilities::decompress(compressed.data(), compressed.size(), length);
+        std::vector<u8> ret(data, data + length);
+        delete[] data;
+        return ret;
+    }();
+    return table;
+}
+
 /**
  * @brief Modifies encounter slots based on the dual slot game
  *
@@ -337,31 +357,35 @@ static void modifyTrophyGarden(std::array<Slot, 12> &pokemon, const std::array<u
  * @param encounter Encounter type
  * @param settings Settings that impact wild encounter slots
  * @param info Personal info array pointer
+ * @param location Only build the area at this location, -1 for every location
  *
  * @return Vector of encounter areas
  */
-static std::vector<EncounterArea4> getDPPt(Game version, Encounter encounter, const EncounterSettings4 &settings, const PersonalInfo *info)
+static std::vector<EncounterArea4> getDPPt(Game version, Encounter encounter, const EncounterSettings4 &settings, const PersonalInfo *info,
+                                           int location)
 {
-    u32 length;
-    u8 *data;
-
+    const std::vector<u8> *data;
     if (version == Game::Diamond)
     {
-        data = Utilities::decompress(DIAMOND.data(), DIAMOND.size(), length);
+        data = &getTable<DIAMOND>();
     }
     else if (version == Game::Pearl)
     {
-        data = Utilities::decompress(PEARL.data(), PEARL.size(), length);
+        data = &getTable<PEARL>();
     }
     else
     {
-        data = Utilities::decompress(PLATINUM.data(), PLATINUM.size(), length);
+        data = &getTable<PLATINUM>();
     }
 
     std::vector<EncounterArea4> encounters;
-    for (size_t offset = 0; offset < length; offset += sizeof(WildEncounterDPPt))
+    for (size_t offset = 0; offset < data->size(); offset += sizeof(WildEncounterDPPt))
     {
-        const auto *entry = reinterpret_cast<const WildEncounterDPPt *>(data + offset);
+        const auto *entry = reinterpret_cast<const WildEncounterDPPt *>(data->data() + offset);
+        if (location != -1 && entry->location != location)
+        {
+            continue;
+        }
 
         std::array<Slot, 12> slots;
         switch (encounter)
@@ -452,7 +476,6 @@ static std::vector<EncounterArea4> getDPPt(Game version, Encounter encounter, co
             break;
         }
     }
-    delete[] data;
     return encounters;
 }
 
@@ -563,18 +586,23 @@ static void modifyTimeHGSS(std::array<Slot, 12> &pokemon, const WildEncounterHGS
  * @param encounter Encounter type
  * @param settings Settings that impact wild encounter slots
  * @param info Personal info array pointer
+ * @param location Only build the area at this location, -1 for every location
  *
  * @return Vector of encounter areas
  */
-static std::vector<EncounterArea4> getHGSSSafari(Encounter encounter, const EncounterSettings4 &settings, const PersonalInfo *info)
+static std::vector<EncounterArea4> getHGSSSafari(Encounter encounter, const EncounterSettings4 &settings, const PersonalInfo *info,
+                                                 int location)
 {
-    u32 length;
-    u8 *data = Utilities::decompress(HGSS_SAFARI.data(), HGSS_SAFARI.size(), length);
+    const std::vector<u8> &data = getTable<HGSS_SAFARI>();
 
     std::vector<EncounterArea4> encounters;
-    for (size_t offset = 0; offset < length; offset += sizeof(WildEncounterHGSSSafari))
+    for (size_t offset = 0; offset < data.size(); offset += sizeof(WildEncounterHGSSSafari))
     {
-        const auto *entry = reinterpret_cast<const WildEncounterHGSSSafari *>(data + offset);
+        const auto *entry = reinterpret_cast<const WildEncounterHGSSSafari *>(data.data() + offset);
+        if (location != -1 && entry->location != location)
+        {
+            continue;
+        }
 
         size_t block = 0;
         const StaticSlot *safariSlots;
@@ -715,7 +743,6 @@ static std::vector<EncounterArea4> getHGSSSafari(Encounter encounter, const Enco
         }
     }
 
-    delete[] data;
     return encounters;
 }
 
@@ -727,24 +754,26 @@ static std::vector<EncounterArea4> getHGSSSafari(Encounter encounter, const Enco
  * @param profile Profile information
  * @param settings Settings that impact wild encounter slots
  * @param info Personal info array pointer
+ * @param location Only build the area at this location, -1 for every location
  *
  * @return Vector of encounter areas
  */
 static std::vector<EncounterArea4> getHGSS(Game version, Encounter encounter, const Profile4 *profile, const EncounterSettings4 &settings,
-                                           const PersonalInfo *info)
+                                           const PersonalInfo *info, int location)
 {
-    u8 *data;
-    u32 length;
-
     std::vector<EncounterArea4> encounters;
     if (encounter == Encounter::BugCatchingContest)
     {
-        data = Utilities::decompress(HGSS_BUG.data(), HGSS_BUG.size(), length);
-        length = profile->getNationalDex() ? length : sizeof(WildEncounterHGSSBug);
+        const std::vector<u8> &data = getTable<HGSS_BUG>();
+        size_t length = profile->getNationalDex() ? data.size() : sizeof(WildEncounterHGSSBug);
         for (size_t offset = profile->getNationalDex() ? sizeof(WildEncounterHGSSBug) : 0; offset < length;
              offset += sizeof(WildEncounterHGSSBug))
         {
-            const auto *entry = reinterpret_cast<const WildEncounterHGSSBug *>(data + offset);
+            const auto *entry = reinterpret_cast<const WildEncounterHGSSBug *>(data.data() + offset);
+            if (location != -1 && entry->location != location)
+            {
+                continue;
+            }
 
             std::array<Slot, 12> slots;
             for (size_t i = 0; i < 10; i++)
@@ -757,19 +786,16 @@ static std::vector<EncounterArea4> getHGSS(Game version, Encounter encounter, co
     }
     else if (encounter == Encounter::Headbutt || encounter == Encounter::HeadbuttAlt || encounter == Encounter::HeadbuttSpecial)
     {
-        if (version == Game::HeartGold)
-        {
-            data = Utilities::decompress(HG_HEADBUTT.data(), HG_HEADBUTT.size(), length);
-        }
-        else
-        {
-            data = Utilities::decompress(SS_HEADBUTT.data(), SS_HEADBUTT.size(), length);
-        }
+        const std::vector<u8> &data = version == Game::HeartGold ? getTable<HG_HEADBUTT>() : getTable<SS_HEADBUTT>();
 
         u8 tree = toInt(encounter) - toInt(Encounter::Headbutt);
-        for (size_t offset = 0; offset < length; offset += sizeof(WildEncounterHGSSHeadbutt))
+        for (size_t offset = 0; offset < data.size(); offset += sizeof(WildEncounterHGSSHeadbutt))
         {
-            const auto *entry = reinterpret_cast<const WildEncounterHGSSHeadbutt *>(data + offset);
+            const auto *entry = reinterpret_cast<const WildEncounterHGSSHeadbutt *>(data.data() + offset);
+            if (location != -1 && entry->location != location)
+            {
+                continue;
+            }
 
             if (encounter != Encounter::HeadbuttSpecial || entry->hasSpecial)
             {
@@ -787,18 +813,15 @@ static std::vector<EncounterArea4> getHGSS(Game version, Encounter encounter, co
     }
     else
     {
-        if (version == Game::HeartGold)
-        {
-            data = Utilities::decompress(HEARTGOLD.data(), HEARTGOLD.size(), length);
-        }
-        else
-        {
-            data = Utilities::decompress(SOULSILVER.data(), SOULSILVER.size(), length);
-        }
+        const std::vector<u8> &data = version == Game::HeartGold ? getTable<HEARTGOLD>() : getTable<SOULSILVER>();
 
-        for (size_t offset = 0; offset < length; offset += sizeof(WildEncounterHGSS))
+        for (size_t offset = 0; offset < data.size(); offset += sizeof(WildEncounterHGSS))
         {
-            const auto *entry = reinterpret_cast<const WildEncounterHGSS *>(data + offset);
+            const auto *entry = reinterpret_cast<const WildEncounterHGSS *>(data.data() + offset);
+            if (location != -1 && entry->location != location)
+            {
+                continue;
+            }
 
             std::array<Slot, 12> slots;
             switch (encounter)
@@ -899,11 +922,10 @@ static std::vector<EncounterArea4> getHGSS(Game version, Encounter encounter, co
             }
         }
 
-        std::vector<EncounterArea4> safariEncounters = getHGSSSafari(encounter, settings, info);
+        std::vector<EncounterArea4> safariEncounters = getHGSSSafari(encounter, settings, info, location);
         encounters.insert(encounters.end(), safariEncounters.begin(), safariEncounters.end());
     }
 
-    delete[] data;
     return encounters;
 }
 
@@ -915,9 +937,20 @@ namespace Encounters4
         const auto *info = PersonalLoader::getPersonal(version);
         if ((version & Game::DPPt) != Game::None)
         {
-            return getDPPt(version, encounter, settings, info);
+            return getDPPt(version, encounter, settings, info, -1);
+        }
+        return getHGSS(version, encounter, profile, settings, info, -1);
+    }
+
+    std::vector<EncounterArea4> getEncounters(Encounter encounter, const EncounterSettings4 &settings, const Profile4 *profile, u8 location)
+    {
+        Game version = profile->getVersion();
+        const auto *info = PersonalLoader::getPersonal(version);
+        if ((version & Game::DPPt) != Game::None)
+        {
+            return getDPPt(version, encounter, settings, info, location);
         }
-        return getHGSS(version, encounter, profile, settings, info);
+        return getHGSS(version, encounter, profile, settings, info, location);
     }
 
     std::array<u16, 15> getGreatMarshPokemon(const Profile4 *profile)
@@ -67,6 +67,20 @@ namespace Encounters4
      */
     std::vector<EncounterArea4> getEncounters(Encounter encounter, const EncounterSettings4 &settings, const Profile4 *profile);
 
+    /**
+     * @brief Gets wild encounters at a single \p location for the \p encounter and \p profile.
+     * Only the matching entries are decoded, which makes it cheap to reapply settings to the selected location.
+     *
+     * @param encounter Encounter type
+     * @param settings Settings that impact wild encounter slots
+     * @param profile Profile information
+     * @param location Location number
+     *
+     * @return Vector of wild encounters
+     */
+    std::vector<EncounterArea4> getEncounters(Encounter encounter, const EncounterSettings4 &settings, const Profile4 *profile,
+                                              u8 location);
+
     /**
      * @brief Returns the changing pokemon of the Great Marsh
      *
@@ -80,36 +80,97 @@ WildGenerator4::WildGenerator4(u32 initialAdvances, u32 maxAdvances, u32 offset,
                                bool unownRadio, u8 happiness, const EncounterArea4 &area, const Profile4 &profile,
                                const WildStateFilter &filter) :
     WildGenerator(initialAdvances, maxAdvances, offset, method, lead, area, profile, filter),
+    generator(nullptr),
     feebasTile(feebasTile),
     shiny(shiny),
     unownRadio(unownRadio),
     happiness(happiness)
 {
-}
+    LeadType type = LeadType::None;
+    if (lead <= Lead::SynchronizeEnd)
+    {
+        type = LeadType::Synchronize;
+    }
+    else if (lead == Lead::CuteCharmF || lead == Lead::CuteCharmM)
+    {
+        type = LeadType::CuteCharm;
+    }
+    else if (lead == Lead::MagnetPull || lead == Lead::Static)
+    {
+        type = LeadType::SlotModifier;
+    }
 
-std::vector<WildGeneratorState4> WildGenerator4::generate(u32 seed, u8 index) const
-{
+    Encounter encounter = area.getEncounter();
+    bool fishing = encounter == Encounter::OldRod || encounter == Encounter::GoodRod || encounter == Encounter::SuperRod;
+
+    // Pick the generation function once so the per advance loop does not branch on the method, lead, or encounter
     switch (method)
     {
     case Method::MethodJ:
-        return generateMethodJ(seed);
+    {
+        constexpr Generate generators[4][2]
+            = { { &WildGenerator4::generateMethodJ<LeadType::None, false>, &WildGenerator4::generateMethodJ<LeadType::None, true> },
+                { &WildGenerator4::generateMethodJ<LeadType::Synchronize, false>,
+                  &WildGenerator4::generateMethodJ<LeadType::Synchronize, true> },
+                { &WildGenerator4::generateMethodJ<LeadType::CuteCharm, false>,
+                  &WildGenerator4::generateMethodJ<LeadType::CuteCharm, true> },
+                { &WildGenerator4::generateMethodJ<LeadType::SlotModifier, false>,
+                  &WildGenerator4::generateMethodJ<LeadType::SlotModifier, true> } };
+        generator = generators[static_cast<u8>(type)][fishing];
+        break;
+    }
     case Method::MethodK:
-        return generateMethodK(seed);
+    {
+        constexpr Generate generators[4][2][2]
+            = { { { &WildGenerator4::generateMethodK<LeadType::None, false, false>,
+                    &WildGenerator4::generateMethodK<LeadType::None, false, true> },
+                  { &WildGenerator4::generateMethodK<LeadType::None, true, false>,
+                    &WildGenerator4::generateMethodK<LeadType::None, true, true> } },
+                { { &WildGenerator4::generateMethodK<LeadType::Synchronize, false, false>,
+                    &WildGenerator4::generateMethodK<LeadType::Synchronize, false, true> },
+                  { &WildGenerator4::generateMethodK<LeadType::Synchronize, true, false>,
+                    &WildGenerator4::generateMethodK<LeadType::Synchronize, true, true> } },
+                { { &WildGenerator4::generateMethodK<LeadType::CuteCharm, false, false>,
+                    &WildGenerator4::generateMethodK<LeadType::CuteCharm, false, true> },
+                  { &WildGenerator4::generateMethodK<LeadType::CuteCharm, true, false>,
+                    &WildGenerator4::generateMethodK<LeadType::CuteCharm, true, true> } },
+                { { &WildGenerator4::generateMethodK<LeadType::SlotModifier, false, false>,
+                    &WildGenerator4::generateMethodK<LeadType::SlotModifier, false, true> },
+                  { &WildGenerator4::generateMethodK<LeadType::SlotModifier, true, false>,
+                    &WildGenerator4::generateMethodK<LeadType::SlotModifier, true, true> } } };
+        bool nibble = fishing || encounter == Encounter::RockSmash;
+        bool retry = encounter == Encounter::BugCatchingContest || area.safariZone(profile.getVersion());
+        generator = generators[static_cast<u8>(type)][nibble][retry];
+        break;
+    }
     case Method::PokeRadar:
-        if (shiny)
-        {
-            return generatePokeRadarShiny(seed, index);
-        }
-        else
-        {
-            return generatePokeRadar(seed, index);
-        }
+    {
+        // Magnet Pull and Static do not affect the Poke Radar
+        constexpr Generate generators[4][2] = {
+            { &WildGenerator4::generatePokeRadar<LeadType::None>, &WildGenerator4::generatePokeRadarShiny<LeadType::None> },
+            { &WildGenerator4::generatePokeRadar<LeadType::Synchronize>, &WildGenerator4::generatePokeRadarShiny<LeadType::Synchronize> },
+            { &WildGenerator4::generatePokeRadar<LeadType::CuteCharm>, &WildGenerator4::generatePokeRadarShiny<LeadType::CuteCharm> },
+            { &WildGenerator4::generatePokeRadar<LeadType::None>, &WildGenerator4::generatePokeRadarShiny<LeadType::None> }
+        };
+        generator = generators[static_cast<u8>(type)][shiny];
+        break;
+    }
     default:
-        return std::vector<WildGeneratorState4>();
+        break;
+    }
+}
+
+std::vector<WildGeneratorState4> WildGenerator4::generate(u32 seed, u8 index) const
+{
+    if (generator)
+    {
+        return (this->*generator)(seed, index);
     }
+    return std::vector<WildGeneratorState4>();
 }
 
-std::vector<WildGeneratorState4> WildGenerator4::generateMethodJ(u32 seed) const
+template <WildGenerator4::LeadType type, bool fishing>
+std::vector<WildGeneratorState4> WildGenerator4::generateMethodJ(u32 seed, u8) const
 {
     std::vector<WildGeneratorState4> states;
 
@@ -128,24 +189,37 @@ std::vector<WildGeneratorState4> WildGenerator4::generateMethodJ(u32 seed) const
         PokeRNG go(rng, jump);
 
         // Fishing nibble check
-        if ((area.getEncounter() == Encounter::OldRod || area.getEncounter() == Encounter::GoodRod
-             || area.getEncounter() == Encounter::SuperRod)
-            && go.nextUShort<false>(100, &battleAdvances) >= thresh)
+        if constexpr (fishing)
         {
-            rng.next();
-            continue;
+            if (go.nextUShort<false>(100, &battleAdvances) >= thresh)
+            {
+                rng.next();
+                continue;
+            }
         }
 
         u8 encounterSlot;
         if (feebas && go.nextUShort<false>(2, &battleAdvances) && feebasTile)
         {
             encounterSlot = 5;
-            go.advance((lead == Lead::MagnetPull || lead == Lead::Static) ? 2 : 1, &battleAdvances);
+            if constexpr (type == LeadType::SlotModifier)
+            {
+                go.advance(2, &battleAdvances);
+            }
+            else
+            {
+                go.advance(1, &battleAdvances);
+            }
         }
         else
         {
-            if ((lead == Lead::MagnetPull || lead == Lead::Static) && go.nextUShort<false>(2, &battleAdvances) == 0
-                && !modifiedSlots.empty())
+            bool modifiedSlot = false;
+            if constexpr (type == LeadType::SlotModifier)
+            {
+                modifiedSlot = go.nextUShort<false>(2, &battleAdvances) == 0 && !modifiedSlots.empty();
+            }
+
+            if (modifiedSlot)
             {
                 encounterSlot = modifiedSlots[go.nextUShort(&battleAdvances)];
             }
@@ -176,7 +250,7 @@ std::vector<WildGeneratorState4> WildGenerator4::generateMethodJ(u32 seed) const
 
         bool cuteCharmFlag = false;
         u8 buffer = 0;
-        if (lead == Lead::CuteCharmF || lead == Lead::CuteCharmM)
+        if constexpr (type == LeadType::CuteCharm)
         {
             switch (info->getGender())
             {
@@ -196,7 +270,7 @@ std::vector<WildGeneratorState4> WildGenerator4::generateMethodJ(u32 seed) const
         }
 
         u8 nature;
-        if (lead <= Lead::SynchronizeEnd)
+        if constexpr (type == LeadType::Synchronize)
         {
             nature = go.nextUShort<false>(2, &battleAdvances) == 0 ? toInt(lead) : go.nextUShort<false>(25, &battleAdvances);
         }
@@ -256,7 +330,8 @@ std::vector<WildGeneratorState4> WildGenerator4::generateMethodJ(u32 seed) const
     return states;
 }
 
-std::vector<WildGeneratorState4> WildGenerator4::generateMethodK(u32 seed) const
+template <WildGenerator4::LeadType type, bool nibble, bool retry>
+std::vector<WildGeneratorState4> WildGenerator4::generateMethodK(u32 seed, u8) const
 {
     std::vector<WildGeneratorState4> states;
 
@@ -290,16 +365,23 @@ std::vector<WildGeneratorState4> WildGenerator4::generateMethodK(u32 seed) const
         PokeRNG go(rng, jump);
 
         // Rock smash/fishing nibble check
-        if ((area.getEncounter() == Encounter::RockSmash || area.getEncounter() == Encounter::OldRod
-             || area.getEncounter() == Encounter::GoodRod || area.getEncounter() == Encounter::SuperRod)
-            && go.nextUShort(100, &battleAdvances) >= rate)
+        if constexpr (nibble)
         {
-            rng.next();
-            continue;
+            if (go.nextUShort(100, &battleAdvances) >= rate)
+            {
+                rng.next();
+                continue;
+            }
+        }
+
+        bool modifiedSlot = false;
+        if constexpr (type == LeadType::SlotModifier)
+        {
+            modifiedSlot = go.nextUShort(2, &battleAdvances) == 0 && !modifiedSlots.empty();
         }
 
         u8 encounterSlot;
-        if ((lead == Lead::MagnetPull || lead == Lead::Static) && go.nextUShort(2, &battleAdvances) == 0 && !modifiedSlots.empty())
+        if (modifiedSlot)
         {
             encounterSlot = modifiedSlots[go.nextUShort(&battleAdvances)];
         }
@@ -336,7 +418,7 @@ std::vector<WildGeneratorState4> WildGenerator4::generateMethodK(u32 seed) const
 
         bool cuteCharmFlag = false;
         u8 buffer = 0;
-        if (lead == Lead::CuteCharmF || lead == Lead::CuteCharmM)
+        if constexpr (type == LeadType::CuteCharm)
         {
             switch (info->getGender())
             {
@@ -374,11 +456,11 @@ std::vector<WildGeneratorState4> WildGenerator4::generateMethodK(u32 seed) const
         }
         else
         {
-            if (area.getEncounter() == Encounter::BugCatchingContest || safari)
+            if constexpr (retry)
             {
                 for (u8 i = 0; i < 4; i++)
                 {
-                    if (lead <= Lead::SynchronizeEnd)
+                    if constexpr (type == LeadType::Synchronize)
                     {
                         nature = go.nextUShort(2, &battleAdvances) == 0 ? toInt(lead) : go.nextUShort(25, &battleAdvances);
                     }
@@ -426,7 +508,7 @@ std::vector<WildGeneratorState4> WildGenerator4::generateMethodK(u32 seed) const
             }
             else
             {
-                if (lead <= Lead::SynchronizeEnd)
+                if constexpr (type == LeadType::Synchronize)
                 {
                     nature = go.nextUShort(2, &battleAdvances) == 0 ? toInt(lead) : go.nextUShort(25, &battleAdvances);
                 }
@@ -495,6 +577,7 @@ std::vector<WildGeneratorState4> WildGenerator4::generateMethodK(u32 seed) const
     return states;
 }
 
+template <WildGenerator4::LeadType type>
 std::vector<WildGeneratorState4> WildGenerator4::generatePokeRadar(u32 seed, u8 index) const
 {
     std::vector<WildGeneratorState4> states;
@@ -533,12 +616,12 @@ std::vector<WildGeneratorState4> WildGenerator4::generatePokeRadar(u32 seed, u8
         u32 pid;
 
         bool cuteCharmFlag = false;
-        if ((lead == Lead::CuteCharmF || lead == Lead::CuteCharmM) && cuteCharm)
+        if constexpr (type == LeadType::CuteCharm)
         {
-            cuteCharmFlag = go.nextUShort<false>(3, &battleAdvances) != 0;
+            cuteCharmFlag = cuteCharm && go.nextUShort<false>(3, &battleAdvances) != 0;
         }
 
-        if (lead <= Lead::SynchronizeEnd)
+        if constexpr (type == LeadType::Synchronize)
         {
             nature = go.nextUShort<false>(2, &battleAdvances) == 0 ? toInt(lead) : go.nextUShort<false>(25, &battleAdvances);
         }
@@ -591,6 +674,7 @@ std::vector<WildGeneratorState4> WildGenerator4::generatePokeRadar(u32 seed, u8
     return states;
 }
 
+template <WildGenerator4::LeadType type>
 std::vector<WildGeneratorState4> WildGenerator4::generatePokeRadarShiny(u32 seed, u8 index) const
 {
     std::vector<WildGeneratorState4> states;
@@ -642,14 +726,25 @@ std::vector<WildGeneratorState4> WildGenerator4::generatePokeRadarShiny(u32 seed
             return static_cast<u32>((high << 16) | low);
         };
 
-        if ((lead == Lead::CuteCharmF || lead == Lead::CuteCharmM) && cuteCharm && go.nextUShort<false>(3, &battleAdvances) != 0)
+        bool cuteCharmFlag = false;
+        bool synchronizeFlag = false;
+        if constexpr (type == LeadType::CuteCharm)
+        {
+            cuteCharmFlag = cuteCharm && go.nextUShort<false>(3, &battleAdvances) != 0;
+        }
+        else if constexpr (type == LeadType::Synchronize)
+        {
+            synchronizeFlag = go.nextUShort<false>(2, &battleAdvances) == 0;
+        }
+
+        if (cuteCharmFlag)
         {
             do
             {
                 pid = shinyPID();
             } while (!cuteCharmCheck(info, pid));
         }
-        else if (lead <= Lead::SynchronizeEnd && go.nextUShort<false>(2, &battleAdvances) == 0)
+        else if (synchronizeFlag)
         {
             do
             {
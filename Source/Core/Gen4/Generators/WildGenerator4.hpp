@@ -63,6 +63,20 @@ public:
     std::vector<WildGeneratorState4> generate(u32 seed, u8 index) const;
 
 private:
+    /**
+     * @brief Groups of leads that change how the encounter is generated
+     */
+    enum class LeadType : u8
+    {
+        None,
+        Synchronize,
+        CuteCharm,
+        SlotModifier
+    };
+
+    using Generate = std::vector<WildGeneratorState4> (WildGenerator4::*)(u32 seed, u8 index) const;
+
+    Generate generator;
     bool feebasTile;
     bool shiny;
     bool unownRadio;
@@ -71,39 +85,52 @@ private:
     /**
      * @brief Generates states via Method J
      *
+     * @tparam type Lead group
+     * @tparam fishing Whether the encounter is a fishing encounter
      * @param seed Starting PRNG state
+     * @param index Unused, shared by all generation functions
      *
      * @return Vector of computed states
      */
-    std::vector<WildGeneratorState4> generateMethodJ(u32 seed) const;
+    template <LeadType type, bool fishing>
+    std::vector<WildGeneratorState4> generateMethodJ(u32 seed, u8 index) const;
 
     /**
      * @brief Generates states via Method K
      *
+     * @tparam type Lead group
+     * @tparam nibble Whether the encounter is a rock smash or fishing encounter
+     * @tparam retry Whether the encounter is a bug catching contest or safari zone encounter
      * @param seed Starting PRNG state
+     * @param index Unused, shared by all generation functions
      *
      * @return Vector of computed states
      */
-    std::vector<WildGeneratorState4> generateMethodK(u32 seed) const;
+    template <LeadType type, bool nibble, bool retry>
+    std::vector<WildGeneratorState4> generateMethodK(u32 seed, u8 index) const;
 
     /**
      * @brief Generates states via Poke Radar
      *
+     * @tparam type Lead group
      * @param seed Starting PRNG state
      * @param index Pokeradar slot index
      *
      * @return Vector of computed states
      */
+    template <LeadType type>
     std::vector<WildGeneratorState4> generatePokeRadar(u32 seed, u8 index) const;
 
     /**
      * @brief Generates states via Poke Radar chained shiny
      *
+     * @tparam type Lead group
      * @param seed Starting PRNG state
      * @param index Pokeradar slot index
      *
      * @return Vector of computed states
      */
+    template <LeadType type>
     std::vector<WildGeneratorState4> generatePokeRadarShiny(u32 seed, u8 index) const;
 };
 
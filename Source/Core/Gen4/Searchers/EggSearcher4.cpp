@@ -54,7 +54,7 @@ void EggSearcher4::startSearch(const EggGenerator4 &generator)
                 auto states = generator.generate(seed, seed);
                 if (!states.empty())
                 {
-                    std::lock_guard<std::mutex> lock(mutex);
+                    auto lock = lockResults();
                     results.reserve(results.capacity() + states.size());
                     for (const auto &state : states)
                     {
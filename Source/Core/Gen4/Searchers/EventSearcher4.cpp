@@ -27,13 +27,20 @@
 
 EventSearcher4::EventSearcher4(u32 minAdvance, u32 maxAdvance, u32 minDelay, u32 maxDelay, const Profile4 &profile,
                                const StateFilter &filter) :
-    Searcher(Method::None, profile), maxAdvance(maxAdvance), minAdvance(minAdvance), maxDelay(maxDelay), minDelay(minDelay), filter(filter)
+    Searcher(Method::None, profile), solver(minAdvance, maxAdvance, minDelay, maxDelay), filter(filter)
 {
 }
 
+void EventSearcher4::enableTelemetry()
+{
+    Searcher::enableTelemetry();
+    filter.setTelemetry(telemetry.get());
+}
+
 void EventSearcher4::startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max, u16 species, u8 nature, u8 level)
 {
     searching = true;
+    solver.prepare(searching);
 
     for (u8 hp = min[0]; hp <= max[0]; hp++)
     {
@@ -45,19 +52,27 @@ void EventSearcher4::startSearch(const std::array<u8, 6> &min, const std::array<
                 {
                     for (u8 spd = min[4]; spd <= max[4]; spd++)
                     {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        if (!searching)
                         {
-                            if (!searching)
-                            {
-                                return;
-                            }
+                            return;
+                        }
 
-                            auto states = search(hp, atk, def, spa, spd, spe, species, nature, level);
+                        u32 seeds[6 * 32];
+                        int offsets[33];
+                        LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, min[5], max[5], seeds, offsets, Method::Method1);
 
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
+                        std::vector<SearcherState4> tile;
+                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        {
+                            int i = spe - min[5];
+                            auto states = search(hp, atk, def, spa, spd, spe, seeds + offsets[i], offsets[i + 1] - offsets[i], species,
+                                                 nature, level);
+                            tile.insert(tile.end(), states.begin(), states.end());
                         }
+
+                        auto guard = lockResults();
+                        results.insert(results.end(), tile.begin(), tile.end());
+                        progress += max[5] - min[5] + 1;
                     }
                 }
             }
@@ -65,7 +80,8 @@ void EventSearcher4::startSearch(const std::array<u8, 6> &min, const std::array<
     }
 }
 
-std::vector<SearcherState4> EventSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u16 species, u8 nature, u8 level) const
+std::vector<SearcherState4> EventSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size, u16 species,
+                                                   u8 nature, u8 level) const
 {
     std::vector<SearcherState4> states;
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
@@ -77,8 +93,6 @@ std::vector<SearcherState4> EventSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa
         return states;
     }
 
-    u32 seeds[6];
-    int size = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, seeds, Method::Method1);
     for (int i = 0; i < size; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -98,23 +112,7 @@ std::vector<SearcherState4> EventSearcher4::searchInitialSeeds(const std::vector
 
     for (SearcherState4 result : results)
     {
-        PokeRNGR rng(result.getSeed(), minAdvance);
-        u32 seed = rng.getSeed();
-        for (u32 cnt = minAdvance; cnt <= maxAdvance; cnt++)
-        {
-            u8 hour = (seed >> 16) & 0xFF;
-            u16 delay = seed & 0xFFFF;
-
-            // Check if seed matches a valid gen 4 format
-            if (hour < 24 && delay >= minDelay && delay <= maxDelay)
-            {
-                result.setSeed(seed);
-                result.setAdvances(cnt);
-                states.emplace_back(result);
-            }
-
-            seed = rng.next();
-        }
+        solver.solve(result, states);
     }
 
     return states;
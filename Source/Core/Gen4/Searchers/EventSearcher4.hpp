@@ -21,6 +21,7 @@
 #define EVENTSEARCHER4_HPP
 
 #include <Core/Gen4/Profile4.hpp>
+#include <Core/Gen4/Searchers/InitialSeedSolver4.hpp>
 #include <Core/Gen4/States/State4.hpp>
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/Parents/Searchers/Searcher.hpp>
@@ -54,11 +55,13 @@ public:
      */
     void startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max, u16 species, u8 nature, u8 level);
 
+    /**
+     * @brief Starts collecting telemetry for the search, including the filter rejections. Must be called before the search is started.
+     */
+    void enableTelemetry() override;
+
 private:
-    u32 maxAdvance;
-    u32 minAdvance;
-    u32 maxDelay;
-    u32 minDelay;
+    InitialSeedSolver4 solver;
     StateFilter filter;
 
     /**
@@ -70,13 +73,16 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      * @param species Pokemon specie
      * @param nature Pokemon nature
      * @param level Pokemon level
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState4> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u16 species, u8 nature, u8 level) const;
+    std::vector<SearcherState4> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size, u16 species, u8 nature,
+                                       u8 level) const;
 
     /**
      * @brief Searches for initial seeds within min/max advances and min/max delay
@@ -19,18 +19,77 @@
 
 #include "IDSearcher4.hpp"
 #include <Core/Gen4/States/IDState4.hpp>
+#include <Core/Parents/Searchers/SearchCheckpoint.hpp>
 #include <Core/RNG/MTFast.hpp>
+#include <algorithm>
 
-IDSearcher4::IDSearcher4(const IDFilter &filter) : filter(filter)
+constexpr u32 unitDelays = 256;
+
+IDSearcher4::IDSearcher4(const IDFilter &filter) : filter(filter), key(0), interval(0)
+{
+}
+
+void IDSearcher4::setCheckpoint(const std::string &path, u64 key, u32 interval)
 {
+    this->path = path;
+    this->key = key;
+    this->interval = interval;
 }
 
 void IDSearcher4::startSearch(bool infinite, u16 year, u32 minDelay, u32 maxDelay)
 {
     searching = true;
     maxDelay = infinite ? 0xe8ffff : maxDelay;
+    if (minDelay > maxDelay)
+    {
+        return;
+    }
+
+    // Delays are searched in work units so the search can be checkpointed
+    u32 units = (maxDelay - minDelay) / unitDelays + 1;
+    u32 parameters[3] = { year, minDelay, maxDelay };
+    u64 id = SearchCheckpoint::hash(parameters, sizeof(parameters)) ^ key;
+
+    SearchCheckpoint checkpoint(units, sizeof(IDState4));
+    if (!path.empty() && checkpoint.load(path, id))
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        results = checkpoint.getResults<IDState4>();
+    }
+
+    std::vector<IDState4> found;
+    for (u32 unit = 0; unit < units; unit++)
+    {
+        u32 first = minDelay + unit * unitDelays;
+        u32 last = std::min(maxDelay, first + (unitDelays - 1));
+        if (checkpoint.isComplete(unit))
+        {
+            progress += (last - first + 1) * 256 * 24;
+            continue;
+        }
+
+        found.clear();
+        if (!searchDelays(year, first, last, found))
+        {
+            break;
+        }
 
-    for (u32 efgh = minDelay; efgh <= maxDelay; efgh++)
+        checkpoint.complete(unit, found);
+        if (!path.empty() && checkpoint.isDirty(interval))
+        {
+            checkpoint.save(path, id);
+        }
+    }
+
+    if (!path.empty())
+    {
+        checkpoint.save(path, id);
+    }
+}
+
+bool IDSearcher4::searchDelays(u16 year, u32 first, u32 last, std::vector<IDState4> &found)
+{
+    for (u32 efgh = first; efgh <= last; efgh++)
     {
         for (u16 ab = 0; ab < 256; ab++)
         {
@@ -38,7 +97,7 @@ void IDSearcher4::startSearch(bool infinite, u16 year, u32 minDelay, u32 maxDela
             {
                 if (!searching)
                 {
-                    return;
+                    return false;
                 }
 
                 u32 seed = static_cast<u32>((ab << 24) | (cd << 16)) + efgh;
@@ -52,12 +111,14 @@ void IDSearcher4::startSearch(bool infinite, u16 year, u32 minDelay, u32 maxDela
                 IDState4 state(seed, efgh + 2000 - year, tid, sid);
                 if (filter.compareState(static_cast<const IDState &>(state)))
                 {
-                    std::lock_guard<std::mutex> guard(mutex);
+                    auto guard = lockResults();
                     results.emplace_back(state);
+                    found.emplace_back(state);
                 }
 
                 progress++;
             }
         }
     }
+    return true;
 }
@@ -22,6 +22,7 @@
 
 #include <Core/Parents/Filters/IDFilter.hpp>
 #include <Core/Parents/Searchers/Searcher.hpp>
+#include <string>
 
 class IDState4;
 
@@ -38,6 +39,16 @@ public:
      */
     IDSearcher4(const IDFilter &filter);
 
+    /**
+     * @brief Enables saving the search progress to a file. If the file holds progress of a previous search with the same
+     * year, delays and \p key the search resumes from it.
+     *
+     * @param path Checkpoint file
+     * @param key Identifier of the filter settings
+     * @param interval Number of completed work units between saves
+     */
+    void setCheckpoint(const std::string &path, u64 key, u32 interval = 16);
+
     /**
      * @brief Starts the search
      *
@@ -50,6 +61,22 @@ public:
 
 private:
     IDFilter filter;
+    std::string path;
+    u64 key;
+    u32 interval;
+
+    /**
+     * @brief Searches the delays of a single work unit
+     *
+     * @param year Search year
+     * @param first First delay
+     * @param last Last delay
+     * @param found Results found in the work unit
+     *
+     * @return true Work unit was completed
+     * @return false Search was cancelled
+     */
+    bool searchDelays(u16 year, u32 first, u32 last, std::vector<IDState4> &found);
 };
 
 #endif // IDSEARCHER4_HPP
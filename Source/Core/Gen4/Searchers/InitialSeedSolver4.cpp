@@ -0,0 +1,85 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "InitialSeedSolver4.hpp"
+#include <algorithm>
+#include <mutex>
+
+constexpr u32 maxTableSize = 1 << 24;
+
+InitialSeedSolver4::InitialSeedSolver4(u32 minAdvance, u32 maxAdvance, u32 minDelay, u32 maxDelay) :
+    maxAdvance(maxAdvance), minAdvance(minAdvance), maxDelay(std::min(maxDelay, 0xffffu)), minDelay(minDelay)
+{
+}
+
+void InitialSeedSolver4::prepare(const bool &searching)
+{
+    table.reset();
+    if (minAdvance > maxAdvance || minDelay > maxDelay)
+    {
+        return;
+    }
+
+    // Stepping backwards costs the advance window for every state while the table costs a position lookup per initial seed
+    // up front. The table wins once the advance window reaches a fraction of the initial seed count.
+    u64 size = 256 * 24 * static_cast<u64>(maxDelay - minDelay + 1);
+    u64 window = static_cast<u64>(maxAdvance) - minAdvance + 1;
+    if (size > maxTableSize || window * 64 < size)
+    {
+        return;
+    }
+
+    // The most recent table is kept so later searches over the same delays skip the rebuild. Holding the lock while building
+    // lets searchers started together wait for one table instead of building their own.
+    static std::mutex mutex;
+    static std::shared_ptr<const std::vector<u32>> cache;
+    static u32 cacheMinDelay;
+    static u32 cacheMaxDelay;
+
+    std::lock_guard<std::mutex> guard(mutex);
+    if (cache && cacheMinDelay == minDelay && cacheMaxDelay == maxDelay)
+    {
+        table = cache;
+        return;
+    }
+
+    std::vector<u32> positions;
+    positions.reserve(size);
+    for (u32 ab = 0; ab < 256; ab++)
+    {
+        if (!searching)
+        {
+            return;
+        }
+
+        for (u32 hour = 0; hour < 24; hour++)
+        {
+            for (u32 delay = minDelay; delay <= maxDelay; delay++)
+            {
+                positions.emplace_back(PokeRNG::distance(0, (ab << 24) | (hour << 16) | delay));
+            }
+        }
+    }
+    std::sort(positions.begin(), positions.end());
+
+    cache = std::make_shared<const std::vector<u32>>(std::move(positions));
+    cacheMinDelay = minDelay;
+    cacheMaxDelay = maxDelay;
+    table = cache;
+}
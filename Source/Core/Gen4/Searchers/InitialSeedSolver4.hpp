@@ -0,0 +1,127 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef INITIALSEEDSOLVER4_HPP
+#define INITIALSEEDSOLVER4_HPP
+
+#include <Core/Global.hpp>
+#include <Core/RNG/LCRNG.hpp>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Recovers the initial seeds and advances that lead to a PRNG state for Gen4 searchers.
+ *
+ * Small advance windows are solved by stepping backwards from the PRNG state. Large advance windows instead enumerate every
+ * valid initial seed once and store its position in the PokeRNG cycle so each PRNG state is solved with a binary search.
+ * The table is shared between every solver with the same delay range.
+ */
+class InitialSeedSolver4
+{
+public:
+    /**
+     * @brief Construct a new InitialSeedSolver4 object
+     *
+     * @param minAdvance Minimum advances
+     * @param maxAdvance Maximum advances
+     * @param minDelay Minimum delay
+     * @param maxDelay Maximum delay
+     */
+    InitialSeedSolver4(u32 minAdvance, u32 maxAdvance, u32 minDelay, u32 maxDelay);
+
+    /**
+     * @brief Acquires the initial seed table if it is cheaper than stepping backwards
+     *
+     * @param searching Search flag that stops building the table once cleared
+     */
+    void prepare(const bool &searching);
+
+    /**
+     * @brief Finds every initial seed within the delay and advance range that leads to the \p state seed
+     *
+     * @tparam State State class that is being searched
+     * @param state State to recover initial seeds for
+     * @param states Vector to store states with their initial seed and advances in
+     */
+    template <class State>
+    void solve(State state, std::vector<State> &states) const
+    {
+        if (!table)
+        {
+            PokeRNGR rng(state.getSeed(), minAdvance);
+            u32 seed = rng.getSeed();
+            for (u32 cnt = minAdvance; cnt <= maxAdvance; cnt++)
+            {
+                u8 hour = (seed >> 16) & 0xFF;
+                u16 delay = seed & 0xFFFF;
+
+                // Check if seed matches a valid gen 4 format
+                if (hour < 24 && delay >= minDelay && delay <= maxDelay)
+                {
+                    state.setSeed(seed);
+                    state.setAdvances(cnt);
+                    states.emplace_back(state);
+                }
+
+                seed = rng.next();
+            }
+        }
+        else
+        {
+            u32 index = PokeRNG::distance(0, state.getSeed());
+            auto first = table->begin();
+            auto last = table->end();
+
+            // Positions are visited in descending order so the advances are ascending
+            auto emit = [&](u32 low, u32 high) {
+                auto begin = std::lower_bound(first, last, low);
+                auto end = std::upper_bound(begin, last, high);
+                while (end != begin)
+                {
+                    u32 position = *--end;
+                    state.setSeed(PokeRNG(0, position).getSeed());
+                    state.setAdvances(index - position);
+                    states.emplace_back(state);
+                }
+            };
+
+            u32 low = index - maxAdvance;
+            u32 high = index - minAdvance;
+            if (low <= high)
+            {
+                emit(low, high);
+            }
+            else
+            {
+                emit(0, high);
+                emit(low, 0xffffffff);
+            }
+        }
+    }
+
+private:
+    std::shared_ptr<const std::vector<u32>> table;
+    u32 maxAdvance;
+    u32 minAdvance;
+    u32 maxDelay;
+    u32 minDelay;
+};
+
+#endif // INITIALSEEDSOLVER4_HPP
@@ -30,10 +30,7 @@
 StaticSearcher4::StaticSearcher4(u32 minAdvance, u32 maxAdvance, u32 minDelay, u32 maxDelay, Method method, Lead lead,
                                  const Profile4 &profile, const StateFilter &filter) :
     StaticSearcher(method, lead, profile, filter),
-    maxAdvance(maxAdvance),
-    minAdvance(minAdvance),
-    maxDelay(maxDelay),
-    minDelay(minDelay),
+    solver(minAdvance, maxAdvance, minDelay, maxDelay),
     buffer(0)
 {
 }
@@ -41,6 +38,7 @@ StaticSearcher4::StaticSearcher4(u32 minAdvance, u32 maxAdvance, u32 minDelay, u
 void StaticSearcher4::startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max, const StaticTemplate4 *staticTemplate)
 {
     searching = true;
+    solver.prepare(searching);
     if (lead == Lead::CuteCharmF)
     {
         buffer = 25 * ((staticTemplate->getInfo()->getGender() / 25) + 1);
@@ -56,19 +54,27 @@ void StaticSearcher4::startSearch(const std::array<u8, 6> &min, const std::array
                 {
                     for (u8 spd = min[4]; spd <= max[4]; spd++)
                     {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        if (!searching)
                         {
-                            if (!searching)
-                            {
-                                return;
-                            }
+                            return;
+                        }
 
-                            auto states = search(hp, atk, def, spa, spd, spe, staticTemplate);
+                        u32 seeds[6 * 32];
+                        int offsets[33];
+                        LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, min[5], max[5], seeds, offsets, Method::Method1);
 
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
+                        std::vector<SearcherState4> tile;
+                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        {
+                            int i = spe - min[5];
+                            auto states = search(hp, atk, def, spa, spd, spe, seeds + offsets[i], offsets[i + 1] - offsets[i],
+                                                 staticTemplate);
+                            tile.insert(tile.end(), states.begin(), states.end());
                         }
+
+                        auto guard = lockResults();
+                        results.insert(results.end(), tile.begin(), tile.end());
+                        progress += max[5] - min[5] + 1;
                     }
                 }
             }
@@ -76,22 +82,22 @@ void StaticSearcher4::startSearch(const std::array<u8, 6> &min, const std::array
     }
 }
 
-std::vector<SearcherState4> StaticSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState4> StaticSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
                                                     const StaticTemplate4 *staticTemplate) const
 {
     std::vector<SearcherState4> states;
 
     if (method == Method::Method1)
     {
-        states = searchMethod1(hp, atk, def, spa, spd, spe, staticTemplate);
+        states = searchMethod1(hp, atk, def, spa, spd, spe, seeds, size, staticTemplate);
     }
     else if (method == Method::MethodJ)
     {
-        states = searchMethodJ(hp, atk, def, spa, spd, spe, staticTemplate);
+        states = searchMethodJ(hp, atk, def, spa, spd, spe, seeds, size, staticTemplate);
     }
     else if (method == Method::MethodK)
     {
-        states = searchMethodK(hp, atk, def, spa, spd, spe, staticTemplate);
+        states = searchMethodK(hp, atk, def, spa, spd, spe, seeds, size, staticTemplate);
     }
 
     return searchInitialSeeds(states);
@@ -103,37 +109,19 @@ std::vector<SearcherState4> StaticSearcher4::searchInitialSeeds(const std::vecto
 
     for (SearcherState4 result : results)
     {
-        PokeRNGR rng(result.getSeed(), minAdvance);
-        u32 seed = rng.getSeed();
-        for (u32 cnt = minAdvance; cnt <= maxAdvance; cnt++)
-        {
-            u8 hour = (seed >> 16) & 0xFF;
-            u16 delay = seed & 0xFFFF;
-
-            // Check if seed matches a valid gen 4 format
-            if (hour < 24 && delay >= minDelay && delay <= maxDelay)
-            {
-                result.setSeed(seed);
-                result.setAdvances(cnt);
-                states.emplace_back(result);
-            }
-
-            seed = rng.next();
-        }
+        solver.solve(result, states);
     }
 
     return states;
 }
 
-std::vector<SearcherState4> StaticSearcher4::searchMethod1(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState4> StaticSearcher4::searchMethod1(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
                                                            const StaticTemplate4 *staticTemplate) const
 {
     std::vector<SearcherState4> states;
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
     const PersonalInfo *info = staticTemplate->getInfo();
 
-    u32 seeds[6];
-    int size = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, seeds, Method::Method1);
     for (int i = 0; i < size; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -184,15 +172,13 @@ std::vector<SearcherState4> StaticSearcher4::searchMethod1(u8 hp, u8 atk, u8 def
     return states;
 }
 
-std::vector<SearcherState4> StaticSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState4> StaticSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
                                                            const StaticTemplate4 *staticTemplate) const
 {
     std::vector<SearcherState4> states;
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
     const PersonalInfo *info = staticTemplate->getInfo();
 
-    u32 seeds[6];
-    int size = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, seeds, Method::Method1);
     for (int i = 0; i < size; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -281,15 +267,13 @@ std::vector<SearcherState4> StaticSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def
     return states;
 }
 
-std::vector<SearcherState4> StaticSearcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState4> StaticSearcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
                                                            const StaticTemplate4 *staticTemplate) const
 {
     std::vector<SearcherState4> states;
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
     const PersonalInfo *info = staticTemplate->getInfo();
 
-    u32 seeds[6];
-    int size = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, seeds, Method::Method1);
     for (int i = 0; i < size; i++)
     {
         PokeRNGR rng(seeds[i]);
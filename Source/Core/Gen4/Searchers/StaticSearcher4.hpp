@@ -21,6 +21,7 @@
 #define STATICSEARCHER4_HPP
 
 #include <Core/Gen4/Profile4.hpp>
+#include <Core/Gen4/Searchers/InitialSeedSolver4.hpp>
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/Parents/Searchers/StaticSearcher.hpp>
 
@@ -58,10 +59,7 @@ public:
     void startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max, const StaticTemplate4 *staticTemplate);
 
 private:
-    u32 maxAdvance;
-    u32 minAdvance;
-    u32 maxDelay;
-    u32 minDelay;
+    InitialSeedSolver4 solver;
     u8 buffer;
 
     /**
@@ -73,11 +71,14 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      * @param staticTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState4> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const StaticTemplate4 *staticTemplate) const;
+    std::vector<SearcherState4> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
+                                       const StaticTemplate4 *staticTemplate) const;
 
     /**
      * @brief Searches for initial seeds within min/max advances and min/max delay
@@ -97,11 +98,14 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      * @param staticTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState4> searchMethod1(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const StaticTemplate4 *staticTemplate) const;
+    std::vector<SearcherState4> searchMethod1(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
+                                              const StaticTemplate4 *staticTemplate) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Method J
@@ -112,11 +116,14 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      * @param staticTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState4> searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const StaticTemplate4 *staticTemplate) const;
+    std::vector<SearcherState4> searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
+                                              const StaticTemplate4 *staticTemplate) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Method K
@@ -127,11 +134,14 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      * @param staticTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState4> searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const StaticTemplate4 *staticTemplate) const;
+    std::vector<SearcherState4> searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
+                                              const StaticTemplate4 *staticTemplate) const;
 };
 
 #endif // STATICSEARCHER4_HPP
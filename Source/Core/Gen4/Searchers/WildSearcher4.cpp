@@ -58,10 +58,7 @@ WildSearcher4::WildSearcher4(u32 minAdvance, u32 maxAdvance, u32 minDelay, u32 m
     WildSearcher(method, lead, area, profile, filter),
     unlockedUnown(profile.getUnlockedUnownForms()),
     undiscoveredUnown(profile.getUndiscoveredUnownForms(unlockedUnown)),
-    maxAdvance(maxAdvance),
-    minAdvance(minAdvance),
-    maxDelay(maxDelay),
-    minDelay(minDelay),
+    solver(minAdvance, maxAdvance, minDelay, maxDelay),
     thresh(area.getRate()),
     feebas(area.feebasLocation(profile.getVersion())
            && (area.getEncounter() == Encounter::OldRod || area.getEncounter() == Encounter::GoodRod
@@ -93,6 +90,7 @@ WildSearcher4::WildSearcher4(u32 minAdvance, u32 maxAdvance, u32 minDelay, u32 m
 void WildSearcher4::startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max, u8 index)
 {
     searching = true;
+    solver.prepare(searching);
 
     for (u8 hp = min[0]; hp <= max[0]; hp++)
     {
@@ -104,19 +102,26 @@ void WildSearcher4::startSearch(const std::array<u8, 6> &min, const std::array<u
                 {
                     for (u8 spd = min[4]; spd <= max[4]; spd++)
                     {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        if (!searching)
                         {
-                            if (!searching)
-                            {
-                                return;
-                            }
+                            return;
+                        }
 
-                            auto states = search(hp, atk, def, spa, spd, spe, index);
+                        u32 seeds[6 * 32];
+                        int offsets[33];
+                        LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, min[5], max[5], seeds, offsets, Method::Method1);
 
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
+                        std::vector<WildSearcherState4> tile;
+                        for (u8 spe = min[5]; spe <= max[5]; spe++)
+                        {
+                            int i = spe - min[5];
+                            auto states = search(hp, atk, def, spa, spd, spe, seeds + offsets[i], offsets[i + 1] - offsets[i], index);
+                            tile.insert(tile.end(), states.begin(), states.end());
                         }
+
+                        auto guard = lockResults();
+                        results.insert(results.end(), tile.begin(), tile.end());
+                        progress += max[5] - min[5] + 1;
                     }
                 }
             }
@@ -124,27 +129,28 @@ void WildSearcher4::startSearch(const std::array<u8, 6> &min, const std::array<u
     }
 }
 
-std::vector<WildSearcherState4> WildSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const
+std::vector<WildSearcherState4> WildSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
+                                                      u8 index) const
 {
     std::vector<WildSearcherState4> states;
 
     if (method == Method::MethodJ)
     {
-        states = searchMethodJ(hp, atk, def, spa, spd, spe);
+        states = searchMethodJ(hp, atk, def, spa, spd, spe, seeds, size);
     }
     else if (method == Method::MethodK)
     {
-        states = searchMethodK(hp, atk, def, spa, spd, spe);
+        states = searchMethodK(hp, atk, def, spa, spd, spe, seeds, size);
     }
     else if (method == Method::PokeRadar)
     {
         if (shiny)
         {
-            states = searchPokeRadarShiny(hp, atk, def, spa, spd, spe, index);
+            states = searchPokeRadarShiny(hp, atk, def, spa, spd, spe, seeds, size, index);
         }
         else
         {
-            states = searchPokeRadar(hp, atk, def, spa, spd, spe, index);
+            states = searchPokeRadar(hp, atk, def, spa, spd, spe, seeds, size, index);
         }
     }
 
@@ -157,29 +163,14 @@ std::vector<WildSearcherState4> WildSearcher4::searchInitialSeeds(const std::vec
 
     for (WildSearcherState4 result : results)
     {
-        PokeRNGR rng(result.getSeed(), minAdvance);
-        u32 seed = rng.getSeed();
-        for (u32 cnt = minAdvance; cnt <= maxAdvance; cnt++)
-        {
-            u8 hour = (seed >> 16) & 0xFF;
-            u16 delay = seed & 0xFFFF;
-
-            // Check if seed matches a valid gen 4 format
-            if (hour < 24 && delay >= minDelay && delay <= maxDelay)
-            {
-                result.setSeed(seed);
-                result.setAdvances(cnt);
-                states.emplace_back(result);
-            }
-
-            seed = rng.next();
-        }
+        solver.solve(result, states);
     }
 
     return states;
 }
 
-std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
+std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds,
+                                                             int size) const
 {
     std::vector<WildSearcherState4> states;
 
@@ -188,8 +179,6 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
     bool nibble = area.getEncounter() == Encounter::OldRod || area.getEncounter() == Encounter::GoodRod
         || area.getEncounter() == Encounter::SuperRod;
 
-    u32 seeds[6];
-    int size = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, seeds, Method::Method1);
     for (int i = 0; i < size; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -276,7 +265,7 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
                     }
 
                     u32 pid = nature + buffer;
-                    WildSearcherState4 state(rng.next(), pid, ivs, pid & 1, Utilities::getGender(pid, info), level, nature,
+                    WildSearcherState4 state(rng.next(), lead, pid, ivs, pid & 1, Utilities::getGender(pid, info), level, nature,
                                              Utilities::getShiny<true>(pid, tsv), encounterSlot, item, slot.getSpecie(), form, info);
                     if (filter.compareState(static_cast<const WildSearcherState &>(state)))
                     {
@@ -560,7 +549,7 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
                             form = unownForm;
                         }
 
-                        WildSearcherState4 state(test[i].next(), pid, ivs, pid & 1, Utilities::getGender(pid, info), level, nature,
+                        WildSearcherState4 state(test[i].next(), lead, pid, ivs, pid & 1, Utilities::getGender(pid, info), level, nature,
                                                  Utilities::getShiny<true>(pid, tsv), encounterSlot[i], item, slot.getSpecie(), form, info);
                         if (filter.compareState(static_cast<const WildSearcherState &>(state)))
                         {
@@ -579,7 +568,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
     return states;
 }
 
-std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
+std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds,
+                                                             int size) const
 {
     std::vector<WildSearcherState4> states;
 
@@ -588,8 +578,6 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 d
     bool nibble = area.getEncounter() == Encounter::RockSmash || area.getEncounter() == Encounter::OldRod
         || area.getEncounter() == Encounter::GoodRod || area.getEncounter() == Encounter::SuperRod;
 
-    u32 seeds[6];
-    int size = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, seeds, Method::Method1);
     for (int i = 0; i < size; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -678,7 +666,7 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 d
                     u16 item = getItem(itemRand, lead, info);
 
                     u32 pid = nature + buffer;
-                    WildSearcherState4 state(rng.next(), pid, ivs, pid & 1, Utilities::getGender(pid, info), level, nature,
+                    WildSearcherState4 state(rng.next(), lead, pid, ivs, pid & 1, Utilities::getGender(pid, info), level, nature,
                                              Utilities::getShiny<true>(pid, tsv), encounterSlot, item, slot.getSpecie(),
                                              slot.getSpecie() == 201 ? form : 0, info);
                     if (filter.compareState(static_cast<const WildSearcherState &>(state)))
@@ -844,7 +832,7 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 d
                         const PersonalInfo *info = slot.getInfo();
                         u16 item = getItem(itemRand, lead, info);
 
-                        WildSearcherState4 state(test[i].next(), pid, ivs, pid & 1, Utilities::getGender(pid, info), level, nature,
+                        WildSearcherState4 state(test[i].next(), lead, pid, ivs, pid & 1, Utilities::getGender(pid, info), level, nature,
                                                  Utilities::getShiny<true>(pid, tsv), encounterSlot[i], item, slot.getSpecie(),
                                                  slot.getSpecie() == 201 ? form : 0, info);
                         if (filter.compareState(static_cast<const WildSearcherState &>(state)))
@@ -864,7 +852,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 d
     return states;
 }
 
-std::vector<WildSearcherState4> WildSearcher4::searchPokeRadar(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const
+std::vector<WildSearcherState4> WildSearcher4::searchPokeRadar(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
+                                                               u8 index) const
 {
     std::vector<WildSearcherState4> states;
 
@@ -889,8 +878,6 @@ std::vector<WildSearcherState4> WildSearcher4::searchPokeRadar(u8 hp, u8 atk, u8
         break;
     }
 
-    u32 seeds[6];
-    int size = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, seeds, Method::Method1);
     for (int i = 0; i < size; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -907,7 +894,7 @@ std::vector<WildSearcherState4> WildSearcher4::searchPokeRadar(u8 hp, u8 atk, u8
             if (rng.nextUShort<false>(3) != 0)
             {
                 u32 pid = nature + buffer;
-                WildSearcherState4 state(rng.next(), pid, ivs, pid & 1, Utilities::getGender(pid, info), slot.getMaxLevel(), nature,
+                WildSearcherState4 state(rng.next(), lead, pid, ivs, pid & 1, Utilities::getGender(pid, info), slot.getMaxLevel(), nature,
                                          Utilities::getShiny<true>(pid, tsv), index, item, slot.getSpecie(), 0, info);
                 if (filter.compareState(static_cast<const WildSearcherState &>(state)))
                 {
@@ -964,7 +951,7 @@ std::vector<WildSearcherState4> WildSearcher4::searchPokeRadar(u8 hp, u8 atk, u8
 
                 if (valid)
                 {
-                    WildSearcherState4 state(seed, pid, ivs, pid & 1, Utilities::getGender(pid, info), slot.getMaxLevel(), nature,
+                    WildSearcherState4 state(seed, lead, pid, ivs, pid & 1, Utilities::getGender(pid, info), slot.getMaxLevel(), nature,
                                              Utilities::getShiny<true>(pid, tsv), index, item, slot.getSpecie(), 0, info);
                     if (filter.compareState(static_cast<const WildSearcherState &>(state)))
                     {
@@ -982,7 +969,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchPokeRadar(u8 hp, u8 atk, u8
     return states;
 }
 
-std::vector<WildSearcherState4> WildSearcher4::searchPokeRadarShiny(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const
+std::vector<WildSearcherState4> WildSearcher4::searchPokeRadarShiny(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds,
+                                                                    int size, u8 index) const
 {
     std::vector<WildSearcherState4> states;
 
@@ -1010,8 +998,6 @@ std::vector<WildSearcherState4> WildSearcher4::searchPokeRadarShiny(u8 hp, u8 at
         return (pid & 0xff) < info->getGender();
     };
 
-    u32 seeds[6];
-    int size = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, seeds, Method::Method1);
     for (int i = 0; i < size; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -1056,8 +1042,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchPokeRadarShiny(u8 hp, u8 at
 
                 if (valid)
                 {
-                    WildSearcherState4 state(test.next(), pid, ivs, pid & 1, Utilities::getGender(pid, info), slot.getMaxLevel(), nature,
-                                             Utilities::getShiny<true>(pid, tsv), index, item, slot.getSpecie(), 0, info);
+                    WildSearcherState4 state(test.next(), lead, pid, ivs, pid & 1, Utilities::getGender(pid, info), slot.getMaxLevel(),
+                                             nature, Utilities::getShiny<true>(pid, tsv), index, item, slot.getSpecie(), 0, info);
                     if (filter.compareState(static_cast<const WildSearcherState &>(state)))
                     {
                         states.emplace_back(state);
@@ -1077,7 +1063,7 @@ std::vector<WildSearcherState4> WildSearcher4::searchPokeRadarShiny(u8 hp, u8 at
         }
         else
         {
-            WildSearcherState4 state(rng.next(), pid, ivs, pid & 1, Utilities::getGender(pid, info), slot.getMaxLevel(), nature,
+            WildSearcherState4 state(rng.next(), lead, pid, ivs, pid & 1, Utilities::getGender(pid, info), slot.getMaxLevel(), nature,
                                      Utilities::getShiny<true>(pid, tsv), index, item, slot.getSpecie(), 0, info);
             if (filter.compareState(static_cast<const WildSearcherState &>(state)))
             {
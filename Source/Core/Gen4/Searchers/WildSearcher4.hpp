@@ -22,6 +22,7 @@
 
 #include <Core/Gen4/EncounterArea4.hpp>
 #include <Core/Gen4/Profile4.hpp>
+#include <Core/Gen4/Searchers/InitialSeedSolver4.hpp>
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/Parents/Searchers/WildSearcher.hpp>
 
@@ -65,10 +66,7 @@ public:
 private:
     std::vector<u8> unlockedUnown;
     std::vector<u8> undiscoveredUnown;
-    u32 maxAdvance;
-    u32 minAdvance;
-    u32 maxDelay;
-    u32 minDelay;
+    InitialSeedSolver4 solver;
     u16 thresh;
     bool feebas;
     bool feebasTile;
@@ -86,11 +84,13 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      * @param index Pokeradar slot index
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const;
+    std::vector<WildSearcherState4> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size, u8 index) const;
 
     /**
      * @brief Searches for initial seeds within min/max advances and min/max delay
@@ -110,10 +110,12 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
+    std::vector<WildSearcherState4> searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Method K
@@ -124,10 +126,12 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
+    std::vector<WildSearcherState4> searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Poke Radar
@@ -138,10 +142,13 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> searchPokeRadar(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const;
+    std::vector<WildSearcherState4> searchPokeRadar(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
+                                                    u8 index) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Poke Radar chained shiny
@@ -152,10 +159,13 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
+     * @param size Number of origin seeds
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> searchPokeRadarShiny(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const;
+    std::vector<WildSearcherState4> searchPokeRadarShiny(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const u32 *seeds, int size,
+                                                         u8 index) const;
 };
 
 #endif // WILDSEARCHER4_HPP
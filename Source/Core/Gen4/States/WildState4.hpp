@@ -102,6 +102,7 @@ public:
      * @brief Construct a new WildSearcherState4 object
      *
      * @param seed Seed of the state
+     * @param lead Encounter lead of the state
      * @param pid Pokemon PID
      * @param ivs Pokemon IVs
      * @param ability Pokemon ability
@@ -115,9 +116,9 @@ public:
      * @param form Pokemon form
      * @param info Pokemon information
      */
-    WildSearcherState4(u32 seed, u32 pid, const std::array<u8, 6> &ivs, u8 ability, u8 gender, u8 level, u8 nature, u8 shiny,
-                       u8 encounterSlot, u16 item, u16 specie, u8 form, const PersonalInfo *info) :
-        WildSearcherState(seed, pid, ivs, ability, gender, level, nature, shiny, encounterSlot, item, specie, form, info)
+    WildSearcherState4(u32 seed, Lead lead, u32 pid, const std::array<u8, 6> &ivs, u8 ability, u8 gender, u8 level, u8 nature,
+                       u8 shiny, u8 encounterSlot, u16 item, u16 specie, u8 form, const PersonalInfo *info) :
+        WildSearcherState(seed, lead, pid, ivs, ability, gender, level, nature, shiny, encounterSlot, item, specie, form, info)
     {
     }
 
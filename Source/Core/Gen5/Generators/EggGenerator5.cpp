@@ -39,21 +39,26 @@ EggGenerator5::EggGenerator5(u32 initialAdvances, u32 maxAdvances, u32 offset, c
 }
 
 std::vector<EggState5> EggGenerator5::generate(u64 seed) const
+{
+    return generate(seed, Utilities5::initialAdvances(seed, profile));
+}
+
+std::vector<EggState5> EggGenerator5::generate(u64 seed, u32 advances) const
 {
     switch (profile.getVersion())
     {
     case Game::Black:
     case Game::White:
-        return generateBW(seed);
+        return generateBW(seed, advances);
     case Game::Black2:
     case Game::White2:
-        return generateBW2(seed);
+        return generateBW2(seed, advances);
     default:
         return std::vector<EggState5>();
     }
 }
 
-std::vector<EggState5> EggGenerator5::generateBW(u64 seed) const
+std::vector<EggState5> EggGenerator5::generateBW(u64 seed, u32 advances) const
 {
     const PersonalInfo *base = PersonalLoader::getPersonal(profile.getVersion(), daycare.getEggSpecie());
     const PersonalInfo *male;
@@ -73,7 +78,6 @@ std::vector<EggState5> EggGenerator5::generateBW(u64 seed) const
     std::array<u8, 6> mtIVs;
     std::generate(mtIVs.begin(), mtIVs.end(), [&mt] { return mt.next(); });
 
-    u32 advances = Utilities5::initialAdvances(seed, profile);
     BWRNG rng(seed, advances + initialAdvances);
     auto jump = rng.getJump(offset);
 
@@ -183,7 +187,7 @@ std::vector<EggState5> EggGenerator5::generateBW(u64 seed) const
     return states;
 }
 
-std::vector<EggState5> EggGenerator5::generateBW2(u64 seed) const
+std::vector<EggState5> EggGenerator5::generateBW2(u64 seed, u32 advances) const
 {
     std::vector<EggState5> states;
 
@@ -197,7 +201,6 @@ std::vector<EggState5> EggGenerator5::generateBW2(u64 seed) const
     if (filter.compareAbility(state.getAbility()) && filter.compareNature(state.getNature()) && filter.compareIV(state.getIVs())
         && filter.compareHiddenPower(state.getHiddenPower()))
     {
-        u32 advances = Utilities5::initialAdvances(seed, profile);
         BWRNG rng(seed, advances + initialAdvances);
         auto jump = rng.getJump(offset);
 
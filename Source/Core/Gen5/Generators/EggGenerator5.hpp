@@ -55,6 +55,16 @@ public:
      */
     std::vector<EggState5> generate(u64 seed) const;
 
+    /**
+     * @brief Generates states from an already computed initial advance count
+     *
+     * @param seed Starting PRNG state
+     * @param advances Initial advances from \ref Utilities5::initialAdvances
+     *
+     * @return Vector of computed states
+     */
+    std::vector<EggState5> generate(u64 seed, u32 advances) const;
+
 private:
     bool ditto;
     u8 everstone;
@@ -62,8 +72,8 @@ private:
     u8 poweritem;
     u8 rolls;
 
-    std::vector<EggState5> generateBW(u64 seed) const;
-    std::vector<EggState5> generateBW2(u64 seed) const;
+    std::vector<EggState5> generateBW(u64 seed, u32 advances) const;
+    std::vector<EggState5> generateBW2(u64 seed, u32 advances) const;
     EggState5 generateBW2Egg(u64 seed, const PersonalInfo **info) const;
 };
 
@@ -27,7 +27,9 @@
 
 EventGenerator5::EventGenerator5(u32 initialAdvances, u32 maxAdvances, u32 offset, const PGF &pgf, const Profile5 &profile,
                                  const StateFilter &filter) :
-    Generator(initialAdvances, maxAdvances, offset, Method::None, profile, filter), pgf(pgf)
+    Generator(initialAdvances, maxAdvances, offset, Method::None, profile, filter),
+    pgf(pgf),
+    table(PersonalLoader::getPersonal(profile.getVersion(), pgf.getSpecies()), pgf.getLevel())
 {
     if (!pgf.getEgg())
     {
@@ -37,9 +39,13 @@ EventGenerator5::EventGenerator5(u32 initialAdvances, u32 maxAdvances, u32 offse
 
 std::vector<State5> EventGenerator5::generate(u64 seed) const
 {
-    const PersonalInfo *info = PersonalLoader::getPersonal(profile.getVersion(), pgf.getSpecies());
+    return generate(seed, Utilities5::initialAdvances(seed, profile));
+}
+
+std::vector<State5> EventGenerator5::generate(u64 seed, u32 advances) const
+{
+    const PersonalInfo *info = table.getInfo();
 
-    u32 advances = Utilities5::initialAdvances(seed, profile);
     BWRNG rng(seed, advances + initialAdvances);
     auto jump = rng.getJump(pgf.getAdvances() + offset);
 
@@ -116,8 +122,8 @@ std::vector<State5> EventGenerator5::generate(u64 seed) const
             nature = go.nextUInt(25);
         }
 
-        State5 state(rng.nextUInt(0x1fff), advances + initialAdvances + cnt, pid, ivs, ability, Utilities::getGender(pid, info),
-                     pgf.getLevel(), nature, Utilities::getShiny<true>(pid, tsv), info);
+        State5 state(rng.nextUInt(0x1fff), advances + initialAdvances + cnt, pid, ivs, ability, Utilities::getGender(pid, info), nature,
+                     Utilities::getShiny<true>(pid, tsv), table);
         if (filter.compareState(static_cast<const State &>(state)))
         {
             states.emplace_back(state);
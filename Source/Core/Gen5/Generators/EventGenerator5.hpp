@@ -24,6 +24,7 @@
 #include <Core/Gen5/Profile5.hpp>
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/Parents/Generators/Generator.hpp>
+#include <Core/Parents/StatTable.hpp>
 
 class State5;
 
@@ -54,8 +55,19 @@ public:
      */
     std::vector<State5> generate(u64 seed) const;
 
+    /**
+     * @brief Generates states from an already computed initial advance count
+     *
+     * @param seed Starting PRNG state
+     * @param advances Initial advances from \ref Utilities5::initialAdvances
+     *
+     * @return Vector of computed states
+     */
+    std::vector<State5> generate(u64 seed, u32 advances) const;
+
 private:
     PGF pgf;
+    StatTable table;
 };
 
 #endif // EVENTGENERATOR5_HPP
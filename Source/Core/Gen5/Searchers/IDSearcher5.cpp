@@ -33,10 +33,19 @@ std::vector<SearcherState5<IDState>> IDSearcher5::search(const IDGenerator5 &gen
         {
             sha.setButton(keypress.value);
 
+            auto cached = SeedCache5::find(profile, timer0, date, keypress.value);
             for (u8 second = minSecond; second <= maxSecond; second++)
             {
-                sha.setTime(hour, minute, second, profile.getDSType());
-                u64 seed = sha.hashSeed(alpha);
+                u64 seed;
+                if (cached)
+                {
+                    seed = cached.data()[hour * 3600 + minute * 60 + second];
+                }
+                else
+                {
+                    sha.setTime(hour, minute, second, profile.getDSType());
+                    seed = sha.hashSeed(alpha);
+                }
 
                 auto states = generator.generate(seed);
                 if (!states.empty())
@@ -65,11 +65,17 @@ void ProfileSearcher5::startSearch(int threads, u8 minVFrame, u8 maxVFrame)
     {
         if (i == threads - 1)
         {
-            threadContainer[i] = std::thread([=] { search(minVFrame, maxVFrame); });
+            threadContainer[i] = std::thread([=] {
+                SearchTelemetry::ThreadTimer timer(telemetry.get());
+                search(minVFrame, maxVFrame);
+            });
         }
         else
         {
-            threadContainer[i] = std::thread([=] { search(minVFrame, minVFrame + split - 1); });
+            threadContainer[i] = std::thread([=] {
+                SearchTelemetry::ThreadTimer timer(telemetry.get());
+                search(minVFrame, minVFrame + split - 1);
+            });
         }
     }
 
@@ -111,7 +117,7 @@ void ProfileSearcher5::search(u8 minVFrame, u8 maxVFrame)
                         u64 seed = sha.hashSeed(alpha);
                         if (valid(seed))
                         {
-                            std::lock_guard<std::mutex> lock(mutex);
+                            auto lock = lockResults();
                             results.emplace_back(seed, static_cast<u16>(timer0), static_cast<u8>(vcount), static_cast<u8>(vframe),
                                                  static_cast<u8>(gxStat), second);
                         }
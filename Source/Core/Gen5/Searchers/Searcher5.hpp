@@ -22,12 +22,21 @@
 
 #include <Core/Gen5/Keypresses.hpp>
 #include <Core/Gen5/Profile5.hpp>
+#include <Core/Gen5/SeedCache5.hpp>
+#include <Core/Gen5/States/SearcherKey5.hpp>
 #include <Core/Global.hpp>
+#include <Core/Parents/Searchers/SearchCheckpoint.hpp>
 #include <Core/Parents/Searchers/Searcher.hpp>
 #include <Core/RNG/SHA1.hpp>
 #include <Core/Util/DateTime.hpp>
 #include <Core/Util/Utilities.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <optional>
+#include <string>
 #include <thread>
+#include <type_traits>
 
 class Date;
 class Profile5;
@@ -39,9 +48,10 @@ class SearcherState5;
  *
  * @tparam Generator Generator class to use
  * @tparam State State class to use
+ * @tparam Result Result class to store, either the full SearcherState5 or the compact SearcherKey5
  */
-template <class Generator, class State>
-class Searcher5 : public SearcherBase<SearcherState5<State>>
+template <class Generator, class State, class Result = SearcherState5<State>>
+class Searcher5 : public SearcherBase<Result>
 {
 public:
     /**
@@ -51,10 +61,31 @@ public:
      * @param profile Profile information
      */
     Searcher5(const Generator &generator, const Profile5 &profile) :
-        SearcherBase<SearcherState5<State>>(), generator(generator), profile(profile), keypresses(Keypresses::getKeypresses(profile))
+        SearcherBase<Result>(),
+        generator(generator),
+        profile(profile),
+        keypresses(Keypresses::getKeypresses(profile)),
+        checkpoint(0, sizeof(Result)),
+        key(0),
+        interval(0)
     {
     }
 
+    /**
+     * @brief Enables saving the search progress to a file. If the file holds progress of a previous search with the same
+     * profile, dates and \p key the search resumes from it.
+     *
+     * @param path Checkpoint file
+     * @param key Identifier of the generator and filter settings
+     * @param interval Number of completed work units between saves
+     */
+    void setCheckpoint(const std::string &path, u64 key, u32 interval = 16)
+    {
+        this->path = path;
+        this->key = key;
+        this->interval = interval;
+    }
+
     /**
      * @brief Starts the search
      *
@@ -66,96 +97,278 @@ public:
     {
         this->searching = true;
 
-        auto days = start.daysTo(end) + 1;
-        if (days < threads)
+        // Every Timer0 and day pair is a work unit that can be checkpointed
+        u32 days = start.daysTo(end) + 1;
+        u32 units = days * (profile.getTimer0Max() - profile.getTimer0Min() + 1);
+        threads = static_cast<int>(std::min<u32>(threads, units));
+
+        u64 parameters[] = { start.getJD(),
+                             days,
+                             profile.getMac(),
+                             profile.getTimer0Min(),
+                             profile.getTimer0Max(),
+                             profile.getVCount(),
+                             profile.getVFrame(),
+                             profile.getGxStat(),
+                             static_cast<u64>(profile.getDSType()),
+                             static_cast<u64>(profile.getVersion()),
+                             keypresses.size() };
+        u64 id = SearchCheckpoint::hash(parameters, sizeof(parameters)) ^ key;
+
+        checkpoint = SearchCheckpoint(units, sizeof(Result));
+        if (!path.empty() && checkpoint.load(path, id))
         {
-            threads = days;
+            std::lock_guard<std::mutex> guard(this->mutex);
+            this->results = checkpoint.getResults<Result>();
         }
 
+        std::atomic<u32> next = 0;
         std::vector<std::thread> threadContainer;
-
-        auto daysSplit = days / threads;
-        Date day = start;
         for (int i = 0; i < threads; i++)
         {
-            if (i == threads - 1)
-            {
-                threadContainer.emplace_back([=] { search(day, end); });
-            }
-            else
-            {
-                Date mid = day + (daysSplit - 1);
-                threadContainer.emplace_back([=] { search(day, mid); });
-            }
-            day += daysSplit;
+            threadContainer.emplace_back([&] {
+                SearchTelemetry::ThreadTimer timer(this->telemetry.get());
+                search(next, units, start, days, id);
+            });
         }
 
         for (int i = 0; i < threads; i++)
         {
             threadContainer[i].join();
         }
+
+        if (!path.empty())
+        {
+            checkpoint.save(path, id);
+        }
+    }
+
+    /**
+     * @brief Starts collecting telemetry for the search, including the generator's filter rejections. Must be called before the
+     * search is started.
+     */
+    void enableTelemetry() override
+    {
+        SearcherBase<Result>::enableTelemetry();
+        if constexpr (requires(Generator &generator, SearchTelemetry *telemetry) { generator.setTelemetry(telemetry); })
+        {
+            generator.setTelemetry(this->telemetry.get());
+        }
+    }
+
+    /**
+     * @brief Regenerates the full result recorded by a compact \p key. The key must come from a search with the same generator and
+     * profile.
+     *
+     * @param key Compact search result
+     *
+     * @return Full search result, or nothing if the key does not refer to a key press or state of this searcher
+     */
+    std::optional<SearcherState5<State>> reconstruct(const SearcherKey5 &key) const
+    {
+        if (key.getKeypress() >= keypresses.size())
+        {
+            return std::nullopt;
+        }
+
+        DateTime dt = key.getDateTime();
+        Time time = dt.getTime();
+        const Keypress &keypress = keypresses[key.getKeypress()];
+
+        SHA1 sha(profile);
+        sha.setTimer0(key.getTimer0(), profile.getVCount());
+        sha.setDate(dt.getDate());
+        auto alpha = sha.precompute();
+        sha.setButton(keypress.value);
+        sha.setTime(time.hour(), time.minute(), time.second(), profile.getDSType());
+        u64 seed = sha.hashSeed(alpha);
+
+        u32 advances = 0;
+        if constexpr (usesInitialAdvances)
+        {
+            advances = Utilities5::initialAdvances(seed, profile);
+        }
+
+        auto states = generate(seed, advances);
+        if (key.getIndex() >= states.size())
+        {
+            return std::nullopt;
+        }
+        return SearcherState5<State>(dt, seed, keypress.button, key.getTimer0(), states[key.getIndex()]);
     }
 
 protected:
+    /**
+     * @brief Whether only compact keys are stored for the results
+     */
+    static constexpr bool compact = std::is_same_v<Result, SearcherKey5>;
+
+    /**
+     * @brief Whether the generator accepts initial advances computed ahead of time
+     */
+    static constexpr bool usesInitialAdvances = requires(const Generator &generator, u64 seed, u32 advances) {
+        generator.generate(seed, advances);
+    };
+
     Generator generator;
     Profile5 profile;
     std::vector<Keypress> keypresses;
 
     /**
-     * @brief Searches between the \p start and \p end dates
+     * @brief Generates states for the \p seed, reusing the batched \p advances when the generator supports it
      *
+     * @param seed Starting PRNG state
+     * @param advances Initial advances
+     *
+     * @return Vector of computed states
+     */
+    auto generate(u64 seed, u32 advances) const
+    {
+        if constexpr (usesInitialAdvances)
+        {
+            return generator.generate(seed, advances);
+        }
+        else
+        {
+            return generator.generate(seed);
+        }
+    }
+
+    /**
+     * @brief Searches work units until every unit has been claimed
+     *
+     * @param next Next unclaimed work unit
+     * @param units Number of work units
      * @param start Start date
-     * @param end End date
+     * @param days Number of days searched
+     * @param id Checkpoint identifier
      */
-    void search(const Date &start, const Date &end)
+    void search(std::atomic<u32> &next, u32 units, const Date &start, u32 days, u64 id)
     {
         SHA1 sha(profile);
 
-        for (u16 timer0 = profile.getTimer0Min(); timer0 <= profile.getTimer0Max(); timer0++)
+        // Seeds of the current block, kept to be stored in the seed cache once the block is complete
+        bool store = SeedCache5::isEnabled();
+        std::vector<u64> block(store ? SeedCache5::blockSeeds : 0);
+
+        // Results of the current work unit, kept to be recorded in the checkpoint once the unit is complete
+        std::vector<Result> found;
+
+        for (u32 unit = next++; unit < units; unit = next++)
         {
-            sha.setTimer0(timer0, profile.getVCount());
-            for (Date date = start; date <= end; ++date)
+            if (!path.empty())
             {
-                sha.setDate(date);
-                auto alpha = sha.precompute();
-                for (const auto &keypress : keypresses)
+                std::lock_guard<std::mutex> guard(this->mutex);
+                if (checkpoint.isComplete(unit))
                 {
-                    sha.setButton(keypress.value);
+                    this->progress += keypresses.size();
+                    continue;
+                }
+            }
+
+            u16 timer0 = profile.getTimer0Min() + unit / days;
+            Date date = start + unit % days;
+            found.clear();
+
+            sha.setTimer0(timer0, profile.getVCount());
+            sha.setDate(date);
+            auto alpha = sha.precompute();
+            for (size_t i = 0; i < keypresses.size(); i++)
+            {
+                const Keypress &keypress = keypresses[i];
+                sha.setButton(keypress.value);
 
-                    for (u8 hour = 0; hour < 24; hour++)
+                auto cached = SeedCache5::find(profile, timer0, date, keypress.value);
+                for (u8 hour = 0; hour < 24; hour++)
+                {
+                    for (u8 minute = 0; minute < 60; minute++)
                     {
-                        for (u8 minute = 0; minute < 60; minute++)
+                        if (!this->searching)
                         {
+                            return;
+                        }
+
+                        u32 offset = hour * 3600 + minute * 60;
+                        std::array<u64, 60> hashed;
+                        const u64 *seeds;
+                        if (cached)
+                        {
+                            seeds = cached.data() + offset;
+                        }
+                        else
+                        {
+                            u64 *out = store ? block.data() + offset : hashed.data();
                             for (u8 second = 0; second < 60; second++)
                             {
-                                if (!this->searching)
-                                {
-                                    return;
-                                }
-
                                 sha.setTime(hour, minute, second, profile.getDSType());
-                                u64 seed = sha.hashSeed(alpha);
+                                out[second] = sha.hashSeed(alpha);
+                            }
+                            seeds = out;
+                        }
+
+                        // Generators that start from the probability table get the whole minute resolved in one batch
+                        std::array<u32, 60> advances {};
+                        if constexpr (usesInitialAdvances)
+                        {
+                            Utilities5::initialAdvances(seeds, advances.data(), 60, profile);
+                        }
+
+                        for (u8 second = 0; second < 60; second++)
+                        {
+                            u64 seed = seeds[second];
 
-                                auto states = generator.generate(seed);
-                                if (!states.empty())
+                            auto states = generate(seed, advances[second]);
+                            if (!states.empty())
+                            {
+                                DateTime dt(date, Time(hour, minute, second));
+
+                                auto lock = this->lockResults();
+                                this->results.reserve(this->results.capacity() + states.size());
+                                for (u32 j = 0; j < states.size(); j++)
                                 {
-                                    DateTime dt(date, Time(hour, minute, second));
+                                    if constexpr (compact)
+                                    {
+                                        this->results.emplace_back(dt, timer0, static_cast<u16>(i), j);
+                                    }
+                                    else
+                                    {
+                                        this->results.emplace_back(dt, seed, keypress.button, timer0, states[j]);
+                                    }
 
-                                    std::lock_guard<std::mutex> lock(this->mutex);
-                                    this->results.reserve(this->results.capacity() + states.size());
-                                    for (const auto &state : states)
+                                    if (!path.empty())
                                     {
-                                        this->results.emplace_back(dt, seed, keypress.button, timer0, state);
+                                        found.emplace_back(this->results.back());
                                     }
                                 }
                             }
                         }
                     }
-                    this->progress++;
+                }
+
+                if (store && !cached)
+                {
+                    SeedCache5::insert(profile, timer0, date, keypress.value, block.data());
+                }
+                this->progress++;
+            }
+
+            if (!path.empty())
+            {
+                std::lock_guard<std::mutex> guard(this->mutex);
+                checkpoint.complete(unit, found);
+                if (checkpoint.isDirty(interval))
+                {
+                    checkpoint.save(path, id);
                 }
             }
         }
     }
+
+private:
+    SearchCheckpoint checkpoint;
+    std::string path;
+    u64 key;
+    u32 interval;
 };
 
 #endif // SEARCHER5_HPP
@@ -0,0 +1,347 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SeedCache5.hpp"
+#include <Core/Enum/DSType.hpp>
+#include <Core/Enum/Game.hpp>
+#include <Core/Enum/Language.hpp>
+#include <Core/Gen5/Profile5.hpp>
+#include <Core/Parents/Searchers/SearchCheckpoint.hpp>
+#include <Core/Util/DateTime.hpp>
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Identifies a block by every input of the SHA1 that changes between blocks
+ */
+struct BlockKey
+{
+    u64 values[11];
+};
+
+constexpr char magic[8] = { 'P', 'F', 'S', 'E', 'E', 'D', '5', 0 };
+constexpr u64 headerSize = sizeof(magic) + sizeof(BlockKey);
+constexpr u64 fileSize = headerSize + SeedCache5::blockSeeds * sizeof(u64);
+
+static std::mutex mutex;
+static std::filesystem::path cacheDirectory;
+static bool enabled = false;
+static u64 capacity;
+
+// Most recently used blocks are at the front
+static std::list<u64> order;
+static std::unordered_map<u64, std::list<u64>::iterator> entries;
+
+/**
+ * @brief Computes the key of a block
+ *
+ * @param profile Profile information
+ * @param timer0 Timer0 value
+ * @param date Date of the block
+ * @param button Keypress value
+ *
+ * @return Block key
+ */
+static BlockKey getKey(const Profile5 &profile, u16 timer0, const Date &date, u32 button)
+{
+    return { { static_cast<u64>(profile.getVersion()), static_cast<u64>(profile.getLanguage()), static_cast<u64>(profile.getDSType()),
+               profile.getMac(), profile.getSoftReset(), profile.getVFrame(), profile.getGxStat(), profile.getVCount(), timer0,
+               date.getJD(), button } };
+}
+
+/**
+ * @brief Computes the path of a block file
+ *
+ * @param hash Hash of the block key
+ *
+ * @return Block file path
+ */
+static std::filesystem::path getPath(u64 hash)
+{
+    char name[23];
+    std::snprintf(name, sizeof(name), "%016llx.seeds", hash);
+    return cacheDirectory / name;
+}
+
+/**
+ * @brief Unmaps a block view
+ *
+ * @param view Mapped file
+ */
+static void unmap(const u8 *view)
+{
+#ifdef _WIN32
+    UnmapViewOfFile(view);
+#else
+    munmap(const_cast<u8 *>(view), fileSize);
+#endif
+}
+
+/**
+ * @brief Maps a whole block file as read only
+ *
+ * @param path File to map
+ *
+ * @return Mapped file, or nullptr if the file does not have the size of a block
+ */
+static const u8 *map(const std::filesystem::path &path)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || static_cast<u64>(size.QuadPart) != fileSize)
+    {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+    {
+        return nullptr;
+    }
+
+    // The view keeps the mapping alive
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    return static_cast<const u8 *>(view);
+#else
+    int file = open(path.c_str(), O_RDONLY);
+    if (file == -1)
+    {
+        return nullptr;
+    }
+
+    struct stat info;
+    if (fstat(file, &info) != 0 || static_cast<u64>(info.st_size) != fileSize)
+    {
+        close(file);
+        return nullptr;
+    }
+
+    // The mapping stays valid after the file is closed
+    void *view = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, file, 0);
+    close(file);
+    return view == MAP_FAILED ? nullptr : static_cast<const u8 *>(view);
+#endif
+}
+
+/**
+ * @brief Removes the least recently used blocks until the cache fits in its capacity. The mutex must be held.
+ */
+static void evict()
+{
+    while (order.size() > capacity)
+    {
+        u64 hash = order.back();
+        order.pop_back();
+        entries.erase(hash);
+
+        // Blocks still mapped by a search stay readable until they are unmapped
+        std::error_code error;
+        std::filesystem::remove(getPath(hash), error);
+    }
+}
+
+namespace SeedCache5
+{
+    Block::~Block()
+    {
+        if (view != nullptr)
+        {
+            unmap(view);
+        }
+    }
+
+    const u64 *Block::data() const
+    {
+        return reinterpret_cast<const u64 *>(view + headerSize);
+    }
+
+    Block find(const Profile5 &profile, u16 timer0, const Date &date, u32 button)
+    {
+        BlockKey key = getKey(profile, timer0, date, button);
+        u64 hash = SearchCheckpoint::hash(&key, sizeof(key));
+
+        std::filesystem::path path;
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            auto entry = entries.find(hash);
+            if (!enabled || entry == entries.end())
+            {
+                return Block();
+            }
+
+            order.splice(order.begin(), order, entry->second);
+            path = getPath(hash);
+        }
+
+        const u8 *view = map(path);
+        if (view == nullptr)
+        {
+            return Block();
+        }
+
+        if (std::memcmp(view, magic, sizeof(magic)) != 0 || std::memcmp(view + sizeof(magic), &key, sizeof(key)) != 0)
+        {
+            unmap(view);
+            return Block();
+        }
+
+        // Keep the usage order across runs
+        std::error_code error;
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+
+        return Block(view);
+    }
+
+    bool init(const std::filesystem::path &directory, u64 maxSize)
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        enabled = false;
+        order.clear();
+        entries.clear();
+
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        capacity = maxSize / fileSize;
+        if (capacity == 0 || !std::filesystem::is_directory(directory, error))
+        {
+            return false;
+        }
+        cacheDirectory = directory;
+
+        std::vector<std::pair<std::filesystem::file_time_type, u64>> blocks;
+        for (const auto &file : std::filesystem::directory_iterator(directory, error))
+        {
+            std::string name = file.path().filename().string();
+            if (file.path().extension() != ".seeds" || file.file_size(error) != fileSize)
+            {
+                continue;
+            }
+
+            u64 hash;
+            auto result = std::from_chars(name.data(), name.data() + name.size(), hash, 16);
+            if (result.ec == std::errc() && result.ptr == name.data() + 16)
+            {
+                blocks.emplace_back(file.last_write_time(error), hash);
+            }
+        }
+
+        std::sort(blocks.begin(), blocks.end(), std::greater<>());
+        for (const auto &block : blocks)
+        {
+            order.emplace_back(block.second);
+            entries[block.second] = std::prev(order.end());
+        }
+        evict();
+
+        enabled = true;
+        return true;
+    }
+
+    void insert(const Profile5 &profile, u16 timer0, const Date &date, u32 button, const u64 *seeds)
+    {
+        if (!isEnabled())
+        {
+            return;
+        }
+
+        BlockKey key = getKey(profile, timer0, date, button);
+        u64 hash = SearchCheckpoint::hash(&key, sizeof(key));
+        std::filesystem::path path = getPath(hash);
+
+        // Write to a temporary file first so a partially written block is never mapped
+        std::filesystem::path temp = path;
+        temp += ".tmp";
+        {
+            std::ofstream write(temp, std::ios::binary | std::ios::trunc);
+            write.write(magic, sizeof(magic));
+            write.write(reinterpret_cast<const char *>(&key), sizeof(key));
+            write.write(reinterpret_cast<const char *>(seeds), blockSeeds * sizeof(u64));
+            write.close();
+            if (write.fail())
+            {
+                std::error_code error;
+                std::filesystem::remove(temp, error);
+                return;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temp, path, error);
+        if (error)
+        {
+            std::filesystem::remove(temp, error);
+            return;
+        }
+
+        std::lock_guard<std::mutex> guard(mutex);
+        auto entry = entries.find(hash);
+        if (entry != entries.end())
+        {
+            order.splice(order.begin(), order, entry->second);
+        }
+        else
+        {
+            order.emplace_front(hash);
+            entries[hash] = order.begin();
+            evict();
+        }
+    }
+
+    bool isEnabled()
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        return enabled;
+    }
+
+    void unload()
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        enabled = false;
+        order.clear();
+        entries.clear();
+    }
+}
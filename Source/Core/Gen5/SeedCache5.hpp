@@ -0,0 +1,153 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEEDCACHE5_HPP
+#define SEEDCACHE5_HPP
+
+#include <Core/Global.hpp>
+#include <filesystem>
+
+class Date;
+class Profile5;
+
+/**
+ * @brief Provides an optional on-disk cache of the Gen 5 initial seeds.
+ *
+ * The cache is split into blocks that hold the seed of every second of one day for one profile, timer0 and keypress, which is
+ * the unit of work of a Gen 5 search. Repeating a search over the same profile and dates can then read the seeds from memory
+ * mapped blocks instead of hashing them again. Blocks are evicted least recently used first once the size limit is reached.
+ */
+namespace SeedCache5
+{
+    /**
+     * @brief Number of seeds in a block, one for every second of a day
+     */
+    constexpr u32 blockSeeds = 86400;
+
+    /**
+     * @brief Read only view of a cached block that is unmapped when destroyed
+     */
+    class Block
+    {
+    public:
+        /**
+         * @brief Construct a new empty Block object
+         */
+        Block() : view(nullptr)
+        {
+        }
+
+        /**
+         * @brief Construct a new Block object
+         *
+         * @param view Mapped block file
+         */
+        explicit Block(const u8 *view) : view(view)
+        {
+        }
+
+        /**
+         * @brief Construct a new Block object by taking the view of \p other
+         *
+         * @param other Block to move
+         */
+        Block(Block &&other) noexcept : view(other.view)
+        {
+            other.view = nullptr;
+        }
+
+        Block(const Block &) = delete;
+        Block &operator=(const Block &) = delete;
+
+        /**
+         * @brief Destroy the Block object
+         */
+        ~Block();
+
+        /**
+         * @brief Returns the seeds of the block, indexed by the second of the day
+         *
+         * @return Seeds
+         */
+        const u64 *data() const;
+
+        /**
+         * @brief Returns whether the block was found in the cache
+         *
+         * @return true Block is valid
+         * @return false Block is empty
+         */
+        explicit operator bool() const
+        {
+            return view != nullptr;
+        }
+
+    private:
+        const u8 *view;
+    };
+
+    /**
+     * @brief Looks up the block of seeds for the given SHA1 inputs
+     *
+     * @param profile Profile information
+     * @param timer0 Timer0 value
+     * @param date Date of the block
+     * @param button Keypress value
+     *
+     * @return Cached block, or an empty block if it is not cached or the cache is not enabled
+     */
+    Block find(const Profile5 &profile, u16 timer0, const Date &date, u32 button);
+
+    /**
+     * @brief Enables the cache stored in \p directory, creating it if needed. This must not be called while a search is running.
+     *
+     * @param directory Directory that holds the blocks
+     * @param maxSize Maximum size of the cache in bytes
+     *
+     * @return true if the cache is enabled, false otherwise
+     */
+    bool init(const std::filesystem::path &directory, u64 maxSize);
+
+    /**
+     * @brief Stores a block of seeds for the given SHA1 inputs, evicting the least recently used blocks if the cache is full.
+     * Does nothing if the cache is not enabled.
+     *
+     * @param profile Profile information
+     * @param timer0 Timer0 value
+     * @param date Date of the block
+     * @param button Keypress value
+     * @param seeds Seed of every second of the day
+     */
+    void insert(const Profile5 &profile, u16 timer0, const Date &date, u32 button, const u64 *seeds);
+
+    /**
+     * @brief Returns whether the cache is enabled
+     *
+     * @return true Cache is enabled
+     * @return false Cache is not enabled
+     */
+    bool isEnabled();
+
+    /**
+     * @brief Stops using the cache. The files are kept on disk. This must not be called while a search is running.
+     */
+    void unload();
+}
+
+#endif // SEEDCACHE5_HPP
@@ -0,0 +1,94 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEARCHERKEY5_HPP
+#define SEARCHERKEY5_HPP
+
+#include <Core/Global.hpp>
+#include <Core/Util/DateTime.hpp>
+
+/**
+ * @brief Compact record of a Gen 5 search result. Holds only what is needed to regenerate the full result with
+ * Searcher5::reconstruct, so large searches can keep many more results in memory.
+ */
+class SearcherKey5
+{
+public:
+    /**
+     * @brief Construct a new SearcherKey5 object
+     *
+     * @param dt Date/time, must be between 2000 and 2099
+     * @param timer0 Timer0
+     * @param keypress Index of the key press in the searched key presses
+     * @param index Index of the state in the states generated from the initial seed
+     */
+    SearcherKey5(const DateTime &dt, u16 timer0, u16 keypress, u32 index) : index(index), keypress(keypress), timer0(timer0)
+    {
+        Time time = dt.getTime();
+        seconds = (dt.getDate().getJD() - Date().getJD()) * 86400 + time.hour() * 3600 + time.minute() * 60 + time.second();
+    }
+
+    /**
+     * @brief Returns the date/time of the key
+     *
+     * @return Date/time
+     */
+    DateTime getDateTime() const
+    {
+        return DateTime(Date().getJD() + seconds / 86400, seconds % 86400);
+    }
+
+    /**
+     * @brief Returns the index of the state in the states generated from the initial seed
+     *
+     * @return State index
+     */
+    u32 getIndex() const
+    {
+        return index;
+    }
+
+    /**
+     * @brief Returns the index of the key press in the searched key presses
+     *
+     * @return Key press index
+     */
+    u16 getKeypress() const
+    {
+        return keypress;
+    }
+
+    /**
+     * @brief Returns the Timer0 of the key
+     *
+     * @return Timer0
+     */
+    u16 getTimer0() const
+    {
+        return timer0;
+    }
+
+private:
+    u32 seconds;
+    u32 index;
+    u16 keypress;
+    u16 timer0;
+};
+
+#endif // SEARCHERKEY5_HPP
@@ -48,6 +48,25 @@ public:
     {
     }
 
+    /**
+     * @brief Construct a new State5 object with stats looked up from a precomputed \p table
+     *
+     * @param prng PRNG call to determine Chatot pitch
+     * @param advances Advances of the state
+     * @param pid Pokemon PID
+     * @param ivs Pokemon IVs
+     * @param ability Pokemon ability
+     * @param gender Pokemon gender
+     * @param nature Pokemon nature
+     * @param shiny Pokemon shininess
+     * @param table Pokemon stat table
+     */
+    State5(u16 prng, u32 advances, u32 pid, const std::array<u8, 6> &ivs, u8 ability, u8 gender, u8 nature, u8 shiny,
+           const StatTable &table) :
+        GeneratorState(advances, pid, ivs, ability, gender, nature, shiny, table), chatot(prng / 82)
+    {
+    }
+
     /**
      * @brief Returns the chatot pitch
      *
@@ -0,0 +1,299 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "BlinkCalculator.hpp"
+#include <Core/RNG/Xorshift.hpp>
+#include <algorithm>
+
+using Mask = std::array<u64, 2>;
+
+/**
+ * @brief Linear equation over the 128 bits of the PRNG state
+ */
+struct Equation
+{
+    Mask mask;
+    u8 value;
+};
+
+/**
+ * @brief Checks if bit \p index is set in \p mask
+ *
+ * @param mask Bit mask
+ * @param index Bit index
+ *
+ * @return true Bit is set
+ * @return false Bit is not set
+ */
+static bool getBit(const Mask &mask, int index)
+{
+    return (mask[index >> 6] >> (index & 63)) & 1;
+}
+
+/**
+ * @brief Computes the XOR of \p x and \p y
+ *
+ * @param x First mask
+ * @param y Second mask
+ */
+static void xorMask(Mask &x, const Mask &y)
+{
+    x[0] ^= y[0];
+    x[1] ^= y[1];
+}
+
+/**
+ * @brief Advances a symbolic Xorshift state where every bit is the set of initial state bits it depends on
+ *
+ * @param state Symbolic state, one mask per bit of each 32bit word
+ *
+ * @return Symbolic output of the advance
+ */
+static std::array<Mask, 32> nextSymbolic(std::array<std::array<Mask, 32>, 4> &state)
+{
+    std::array<Mask, 32> t = state[0];
+    const std::array<Mask, 32> &s = state[3];
+
+    // t ^= t << 11
+    for (int b = 31; b >= 11; b--)
+    {
+        xorMask(t[b], t[b - 11]);
+    }
+
+    // t ^= t >> 8
+    for (int b = 0; b < 24; b++)
+    {
+        xorMask(t[b], t[b + 8]);
+    }
+
+    // t ^= s ^ (s >> 19)
+    for (int b = 0; b < 32; b++)
+    {
+        xorMask(t[b], s[b]);
+        if (b < 13)
+        {
+            xorMask(t[b], s[b + 19]);
+        }
+    }
+
+    state[0] = state[1];
+    state[1] = state[2];
+    state[2] = state[3];
+    state[3] = t;
+
+    return t;
+}
+
+/**
+ * @brief Computes the position of each blink in PRNG advances
+ *
+ * @param intervals Frames between consecutive blinks
+ * @param npc Number of NPCs on screen
+ *
+ * @return Advance of each blink relative to the first blink
+ */
+static std::vector<u32> getPositions(const std::vector<u32> &intervals, u8 npc)
+{
+    std::vector<u32> positions = { 0 };
+    for (u32 interval : intervals)
+    {
+        positions.emplace_back(positions.back() + interval * (npc + 1));
+    }
+    return positions;
+}
+
+/**
+ * @brief Checks if the PRNG outputs reproduce the observed blinks, including the frames where no blink happened
+ *
+ * @param outputs PRNG outputs starting at the first blink
+ * @param blinks Blink types in observation order
+ * @param positions Advance of each blink relative to the first blink
+ * @param npc Number of NPCs on screen
+ *
+ * @return true Outputs match the blinks
+ * @return false Outputs do not match the blinks
+ */
+static bool checkBlinks(const u32 *outputs, const std::vector<u8> &blinks, const std::vector<u32> &positions, u8 npc)
+{
+    size_t index = 0;
+    for (u32 advance = 0; advance <= positions.back(); advance += npc + 1)
+    {
+        u32 rand = outputs[advance];
+        bool blink = (rand & 0xe) == 0;
+        if (advance == positions[index])
+        {
+            if (!blink || (rand & 1) != blinks[index])
+            {
+                return false;
+            }
+            index++;
+        }
+        else if (blink)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+namespace BlinkCalculator
+{
+    std::vector<std::array<u64, 2>> recoverState(const std::vector<u8> &blinks, const std::vector<u32> &intervals, u8 npc)
+    {
+        if (blinks.empty() || intervals.size() + 1 != blinks.size() || std::find(intervals.begin(), intervals.end(), 0) != intervals.end())
+        {
+            return {};
+        }
+
+        std::vector<u32> positions = getPositions(intervals, npc);
+
+        std::array<std::array<Mask, 32>, 4> state;
+        for (int i = 0; i < 128; i++)
+        {
+            Mask &mask = state[i / 32][i % 32];
+            mask = { 0, 0 };
+            mask[i >> 6] = 1ull << (i & 63);
+        }
+
+        // Every blink fixes bits 0-3 of the player's PRNG value
+        std::vector<Equation> equations;
+        equations.reserve(blinks.size() * 4);
+        for (u32 advance = 0, index = 0; index < positions.size(); advance++)
+        {
+            auto output = nextSymbolic(state);
+            if (advance == positions[index])
+            {
+                equations.emplace_back(Equation { output[0], blinks[index] });
+                equations.emplace_back(Equation { output[1], 0 });
+                equations.emplace_back(Equation { output[2], 0 });
+                equations.emplace_back(Equation { output[3], 0 });
+                index++;
+            }
+        }
+
+        // Gauss-Jordan elimination over GF(2)
+        std::vector<int> pivots;
+        std::vector<int> free;
+        size_t rank = 0;
+        for (int column = 0; column < 128; column++)
+        {
+            auto it = std::find_if(equations.begin() + rank, equations.end(),
+                                   [column](const Equation &equation) { return getBit(equation.mask, column); });
+            if (it == equations.end())
+            {
+                free.emplace_back(column);
+                continue;
+            }
+
+            std::iter_swap(equations.begin() + rank, it);
+            const Equation &pivot = equations[rank];
+            for (size_t i = 0; i < equations.size(); i++)
+            {
+                if (i != rank && getBit(equations[i].mask, column))
+                {
+                    xorMask(equations[i].mask, pivot.mask);
+                    equations[i].value ^= pivot.value;
+                }
+            }
+
+            pivots.emplace_back(column);
+            rank++;
+        }
+
+        // Rows past the rank are all zero and must not require a value of 1
+        if (std::any_of(equations.begin() + rank, equations.end(), [](const Equation &equation) { return equation.value; }))
+        {
+            return {};
+        }
+
+        // Too few blinks to narrow the state down to a handful of candidates
+        if (free.size() > 16)
+        {
+            return {};
+        }
+
+        std::vector<u32> outputs(positions.back() + 1);
+        std::vector<std::array<u64, 2>> results;
+        for (u32 combination = 0; combination < (1u << free.size()); combination++)
+        {
+            Mask solution = { 0, 0 };
+            for (size_t i = 0; i < free.size(); i++)
+            {
+                if ((combination >> i) & 1)
+                {
+                    solution[free[i] >> 6] |= 1ull << (free[i] & 63);
+                }
+            }
+
+            for (size_t i = 0; i < rank; i++)
+            {
+                u8 value = equations[i].value;
+                for (int column : free)
+                {
+                    value ^= getBit(equations[i].mask, column) & getBit(solution, column);
+                }
+                solution[pivots[i] >> 6] |= static_cast<u64>(value) << (pivots[i] & 63);
+            }
+
+            if (solution[0] == 0 && solution[1] == 0)
+            {
+                continue;
+            }
+
+            // State words are stored as seed0 high, seed0 low, seed1 high, seed1 low
+            u64 seed0 = (solution[0] << 32) | (solution[0] >> 32);
+            u64 seed1 = (solution[1] << 32) | (solution[1] >> 32);
+
+            Xorshift rng(seed0, seed1);
+            std::generate(outputs.begin(), outputs.end(), [&rng] { return rng.next(); });
+            if (checkBlinks(outputs.data(), blinks, positions, npc))
+            {
+                results.emplace_back(rng.getState());
+            }
+        }
+
+        return results;
+    }
+
+    std::vector<u32> reidentifyState(u64 seed0, u64 seed1, const std::vector<u8> &blinks, const std::vector<u32> &intervals, u8 npc,
+                                     u32 maxAdvances)
+    {
+        if (blinks.empty() || intervals.size() + 1 != blinks.size() || std::find(intervals.begin(), intervals.end(), 0) != intervals.end())
+        {
+            return {};
+        }
+
+        std::vector<u32> positions = getPositions(intervals, npc);
+
+        Xorshift rng(seed0, seed1);
+        std::vector<u32> outputs(maxAdvances + positions.back() + 1);
+        std::generate(outputs.begin(), outputs.end(), [&rng] { return rng.next(); });
+
+        std::vector<u32> results;
+        for (u32 advance = 0; advance <= maxAdvances; advance++)
+        {
+            if (checkBlinks(&outputs[advance], blinks, positions, npc))
+            {
+                results.emplace_back(advance + positions.back() + 1);
+            }
+        }
+
+        return results;
+    }
+}
@@ -0,0 +1,62 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef BLINKCALCULATOR_HPP
+#define BLINKCALCULATOR_HPP
+
+#include <Core/Global.hpp>
+#include <array>
+#include <vector>
+
+/**
+ * @brief Recovers the BDSP Xorshift state from the player's blinks.
+ * The player draws one PRNG value per frame and blinks whenever bits 1-3 of that value are clear, with bit 0 selecting between a
+ * single (0) and a double (1) blink. Every NPC on screen draws one extra value per frame.
+ */
+namespace BlinkCalculator
+{
+    /**
+     * @brief Recovers the PRNG state from a sequence of observed blinks
+     * Each blink gives 4 linear equations over the 128 state bits, so at least 32 blinks are required and around 40 are recommended.
+     *
+     * @param blinks Blink types in observation order
+     * @param intervals Non-zero frames between consecutive blinks, one less than the number of blinks
+     * @param npc Number of NPCs on screen
+     *
+     * @return Candidate seed0/seed1 pairs right after the last observed blink
+     */
+    std::vector<std::array<u64, 2>> recoverState(const std::vector<u8> &blinks, const std::vector<u32> &intervals, u8 npc);
+
+    /**
+     * @brief Finds the current advance from a few blinks observed after the PRNG state is known
+     *
+     * @param seed0 Known PRNG state0
+     * @param seed1 Known PRNG state1
+     * @param blinks Blink types in observation order
+     * @param intervals Non-zero frames between consecutive blinks, one less than the number of blinks
+     * @param npc Number of NPCs on screen
+     * @param maxAdvances Maximum number of advances to search
+     *
+     * @return Advances from the known state to right after the last observed blink
+     */
+    std::vector<u32> reidentifyState(u64 seed0, u64 seed1, const std::vector<u8> &blinks, const std::vector<u32> &intervals, u8 npc,
+                                     u32 maxAdvances);
+}
+
+#endif // BLINKCALCULATOR_HPP
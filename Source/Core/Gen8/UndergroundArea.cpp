@@ -22,7 +22,6 @@
 #include <Core/RNG/Xorshift.hpp>
 #include <Core/Util/Translator.hpp>
 #include <algorithm>
-#include <cassert>
 #include <cstring>
 #include <iterator>
 
@@ -44,7 +43,7 @@ static float rand(u32 prng)
 UndergroundArea::UndergroundArea(u8 location, u8 min, u8 max, const std::vector<Pokemon> &pokemon,
                                  const std::vector<SpecialPokemon> &specialPokemon, const std::array<u8, 18> &typeRates,
                                  const std::vector<TypeSize> &typeSizes) :
-    pokemon(pokemon), specialPokemon(specialPokemon), typeSizes(typeSizes), location(location), max(max), min(min)
+    pokemon(pokemon), specialPokemon(specialPokemon), location(location), max(max), min(min)
 {
     for (size_t i = 1; i < this->specialPokemon.size(); i++)
     {
@@ -56,8 +55,8 @@ UndergroundArea::UndergroundArea(u8 location, u8 min, u8 max, const std::vector<
     for (u8 i = 0; i < typeRates.size(); i++)
     {
         u16 rate = typeRates[i];
-        if (std::find_if(this->typeSizes.begin(), this->typeSizes.end(), [i](const TypeSize &typeSize) { return i == typeSize.type; })
-            != this->typeSizes.end())
+        if (std::find_if(typeSizes.begin(), typeSizes.end(), [i](const TypeSize &typeSize) { return i == typeSize.type; })
+            != typeSizes.end())
         {
             typeSum += rate;
             TypeRate typeRate = { rate, i };
@@ -71,48 +70,48 @@ UndergroundArea::UndergroundArea(u8 location, u8 min, u8 max, const std::vector<
     {
         this->typeRates[i].rate += this->typeRates[i - 1].rate;
     }
-}
 
-u16 UndergroundArea::getPokemon(RNGList<u32, Xorshift, 256> &rngList, const TypeSize &type) const
-{
-    u8 tempCount = 0;
-    std::array<TypeSize, 23> temp;
-    for (auto const &typeSize : typeSizes)
+    // Build the pokemon that can be selected for each type and size once, sorted by rate and with the rates made cumulative
+    for (const TypeSize &typeSize : typeSizes)
     {
-        if (type.value == typeSize.value)
+        auto &typeSizeList = sizes[typeSize.type];
+        if (std::find(typeSizeList.begin(), typeSizeList.end(), typeSize.size) == typeSizeList.end())
         {
-            temp[tempCount++] = typeSize;
+            typeSizeList.emplace_back(typeSize.size);
         }
-    }
-    assert(tempCount <= temp.size());
 
-    u8 filteredCount = 0;
-    u16 sum = 0;
-    std::array<Pokemon, 23> filtered;
-    for (const Pokemon &mon : pokemon)
-    {
-        if (std::find_if(temp.begin(), temp.begin() + tempCount,
-                         [mon](const TypeSize &t) { return t.size == mon.size && (t.type == mon.type[0] || t.type == mon.type[1]); })
-            != temp.begin() + tempCount)
+        auto &slots = slotPokemon[typeSize.size * 18 + typeSize.type];
+        if (!slots.empty())
+        {
+            continue;
+        }
+
+        // Type and size pairs can share a value, in which case pokemon matching any of them can be selected
+        auto match = [&typeSizes, typeSize](const Pokemon &mon) {
+            return std::any_of(typeSizes.begin(), typeSizes.end(), [typeSize, mon](const TypeSize &t) {
+                return t.value == typeSize.value && t.size == mon.size && (t.type == mon.type[0] || t.type == mon.type[1]);
+            });
+        };
+        std::copy_if(pokemon.begin(), pokemon.end(), std::back_inserter(slots), match);
+        std::sort(slots.begin(), slots.end(), [](const Pokemon &left, const Pokemon &right) { return left.rate > right.rate; });
+
+        for (size_t i = 1; i < slots.size(); i++)
         {
-            sum += mon.rate;
-            filtered[filteredCount++] = mon;
+            slots[i].rate += slots[i - 1].rate;
         }
     }
-    assert(filteredCount <= filtered.size());
-    assert(tempCount == filteredCount);
-    std::sort(filtered.begin(), filtered.begin() + filteredCount,
-              [](const Pokemon &left, const Pokemon &right) { return left.rate > right.rate; });
+}
+
+u16 UndergroundArea::getPokemon(RNGList<u32, Xorshift, 256> &rngList, const TypeSize &type) const
+{
+    const auto &slots = slotPokemon[type.size * 18 + type.type];
+    u16 sum = slots.empty() ? 0 : slots.back().rate;
 
     float rate = rngList.next(rand) * sum;
-    for (u8 i = 0; i < filteredCount; i++)
+    auto it = std::upper_bound(slots.begin(), slots.end(), rate, [](float rate, const Pokemon &mon) { return rate < mon.rate; });
+    if (it != slots.end())
     {
-        const auto &filter = filtered[i];
-        if (rate < filter.rate)
-        {
-            return filter.specie;
-        }
-        rate -= filter.rate;
+        return it->specie;
     }
 
     return 0;
@@ -125,23 +124,15 @@ std::array<TypeSize, 10> UndergroundArea::getSlots(RNGList<u32, Xorshift, 256> &
     {
         u8 type = 0;
         float rate = rngList.next(rand) * typeSum;
-        auto it = std::find_if(typeRates.begin(), typeRates.end(), [rate](const TypeRate &typeRate) { return rate < typeRate.rate; });
+        auto it = std::upper_bound(typeRates.begin(), typeRates.end(), rate,
+                                   [](float rate, const TypeRate &typeRate) { return rate < typeRate.rate; });
         if (it != typeRates.end())
         {
             type = it->type;
         }
 
-        std::array<u8, 3> sizes;
-        u8 sizeCount = 0;
-        for (const auto &t : typeSizes)
-        {
-            if (t.type == type && std::find(sizes.begin(), sizes.begin() + sizeCount, t.size) == sizes.begin() + sizeCount)
-            {
-                sizes[sizeCount++] = t.size;
-            }
-        }
-
-        u8 size = sizes[rngList.next() % sizeCount];
+        const auto &typeSizeList = sizes[type];
+        u8 size = typeSizeList[rngList.next() % typeSizeList.size()];
         u16 value = pokemonSizes[size] + type;
 
         TypeSize slot = { value, size, type };
@@ -155,7 +146,8 @@ u16 UndergroundArea::getSpecialPokemon(RNGList<u32, Xorshift, 256> &rngList) con
     if ((rngList.next() % 100) < 50)
     {
         float rate = rngList.next(rand) * specialSum;
-        auto it = std::find_if(specialPokemon.begin(), specialPokemon.end(), [rate](const SpecialPokemon &mon) { return rate < mon.rate; });
+        auto it = std::upper_bound(specialPokemon.begin(), specialPokemon.end(), rate,
+                                   [](float rate, const SpecialPokemon &mon) { return rate < mon.rate; });
         if (it != specialPokemon.end())
         {
             return it->specie;
@@ -110,8 +110,8 @@ public:
 
     /**
      * @brief Returns the pokemon to create based on the \p type
-     * Filters from the available pokemon ones that match the necessary type and size. This filtered list is then randomly selected from
-     * based upon the pokemon encounter rates.
+     * The available pokemon that match the necessary type and size are filtered when the area is constructed. This filtered list is then
+     * randomly selected from based upon the pokemon encounter rates.
      *
      * @param rngList RNG object
      * @param type Pokemon type and associated size
@@ -155,10 +155,11 @@ public:
     std::vector<std::string> getSpecieNames() const;
 
 private:
+    std::array<std::vector<Pokemon>, 4 * 18> slotPokemon;
+    std::array<std::vector<u8>, 18> sizes;
     std::vector<Pokemon> pokemon;
     std::vector<SpecialPokemon> specialPokemon;
     std::vector<TypeRate> typeRates;
-    std::vector<TypeSize> typeSizes;
     u16 specialSum;
     u16 typeSum;
     u8 location;
@@ -18,27 +18,36 @@
  */
 
 #include "StateFilter.hpp"
+#include <Core/Parents/Searchers/SearchTelemetry.hpp>
 #include <Core/Parents/States/WildState.hpp>
 
 StateFilter::StateFilter(u8 gender, u8 ability, u8 shiny, bool skip, const std::array<u8, 6> &min, const std::array<u8, 6> &max,
                          const std::array<bool, 25> &natures, const std::array<bool, 16> &powers) :
-    natures(natures), powers(powers), max(max), min(min), skip(skip), ability(ability), gender(gender), shiny(shiny)
+    natures(natures),
+    powers(powers),
+    max(max),
+    min(min),
+    telemetry(nullptr),
+    skip(skip),
+    ability(ability),
+    gender(gender),
+    shiny(shiny)
 {
 }
 
 bool StateFilter::compareAbility(u8 ability) const
 {
-    return skip || this->ability == 255 || this->ability == ability;
+    return skip || this->ability == 255 || this->ability == ability || reject(FilterStage::Ability);
 }
 
 bool StateFilter::compareGender(u8 gender) const
 {
-    return skip || this->gender == 255 || this->gender == gender;
+    return skip || this->gender == 255 || this->gender == gender || reject(FilterStage::Gender);
 }
 
 bool StateFilter::compareHiddenPower(u8 hiddenPower) const
 {
-    return skip || powers[hiddenPower];
+    return skip || powers[hiddenPower] || reject(FilterStage::HiddenPower);
 }
 
 bool StateFilter::compareIV(const std::array<u8, 6> &ivs) const
@@ -53,7 +62,7 @@ bool StateFilter::compareIV(const std::array<u8, 6> &ivs) const
         u8 iv = ivs[i];
         if (iv < min[i] || iv > max[i])
         {
-            return false;
+            return reject(FilterStage::IV);
         }
     }
 
@@ -62,34 +71,39 @@ bool StateFilter::compareIV(const std::array<u8, 6> &ivs) const
 
 bool StateFilter::compareNature(u8 nature) const
 {
-    return skip || natures[nature];
+    return skip || natures[nature] || reject(FilterStage::Nature);
 }
 
 bool StateFilter::compareShiny(u8 shiny) const
 {
-    return skip || this->shiny == 255 || (this->shiny & shiny);
+    return skip || this->shiny == 255 || (this->shiny & shiny) || reject(FilterStage::Shiny);
 }
 
 bool StateFilter::compareState(const SearcherState &state) const
 {
+    if (telemetry)
+    {
+        telemetry->addCandidate();
+    }
+
     if (ability != 255 && ability != state.getAbility())
     {
-        return false;
+        return reject(FilterStage::Ability);
     }
 
     if (gender != 255 && gender != state.getGender())
     {
-        return false;
+        return reject(FilterStage::Gender);
     }
 
     if (!powers[state.getHiddenPower()])
     {
-        return false;
+        return reject(FilterStage::HiddenPower);
     }
 
     if (shiny != 255 && !(shiny & state.getShiny()))
     {
-        return false;
+        return reject(FilterStage::Shiny);
     }
 
     return true;
@@ -97,6 +111,11 @@ bool StateFilter::compareState(const SearcherState &state) const
 
 bool StateFilter::compareState(const State &state) const
 {
+    if (telemetry)
+    {
+        telemetry->addCandidate();
+    }
+
     if (skip)
     {
         return true;
@@ -104,27 +123,27 @@ bool StateFilter::compareState(const State &state) const
 
     if (ability != 255 && ability != state.getAbility())
     {
-        return false;
+        return reject(FilterStage::Ability);
     }
 
     if (gender != 255 && gender != state.getGender())
     {
-        return false;
+        return reject(FilterStage::Gender);
     }
 
     if (!powers[state.getHiddenPower()])
     {
-        return false;
+        return reject(FilterStage::HiddenPower);
     }
 
     if (!natures[state.getNature()])
     {
-        return false;
+        return reject(FilterStage::Nature);
     }
 
     if (shiny != 255 && !(shiny & state.getShiny()))
     {
-        return false;
+        return reject(FilterStage::Shiny);
     }
 
     for (int i = 0; i < 6; i++)
@@ -132,13 +151,27 @@ bool StateFilter::compareState(const State &state) const
         u8 iv = state.getIV(i);
         if (iv < min[i] || iv > max[i])
         {
-            return false;
+            return reject(FilterStage::IV);
         }
     }
 
     return true;
 }
 
+void StateFilter::setTelemetry(SearchTelemetry *telemetry)
+{
+    this->telemetry = telemetry;
+}
+
+bool StateFilter::reject(FilterStage stage) const
+{
+    if (telemetry)
+    {
+        telemetry->addRejection(stage);
+    }
+    return false;
+}
+
 WildStateFilter::WildStateFilter(u8 gender, u8 ability, u8 shiny, bool skip, const std::array<u8, 6> &min, const std::array<u8, 6> &max,
                                  const std::array<bool, 25> &natures, const std::array<bool, 16> &powers,
                                  const std::array<bool, 12> &encounterSlots) :
@@ -148,11 +181,16 @@ WildStateFilter::WildStateFilter(u8 gender, u8 ability, u8 shiny, bool skip, con
 
 bool WildStateFilter::compareEncounterSlot(u8 encounterSlot) const
 {
-    return skip || encounterSlots[encounterSlot];
+    return skip || encounterSlots[encounterSlot] || reject(FilterStage::EncounterSlot);
 }
 
 bool WildStateFilter::compareState(const WildGeneratorState &state) const
 {
+    if (telemetry)
+    {
+        telemetry->addCandidate();
+    }
+
     if (skip)
     {
         return true;
@@ -160,22 +198,22 @@ bool WildStateFilter::compareState(const WildGeneratorState &state) const
 
     if (ability != 255 && ability != state.getAbility())
     {
-        return false;
+        return reject(FilterStage::Ability);
     }
 
     if (gender != 255 && gender != state.getGender())
     {
-        return false;
+        return reject(FilterStage::Gender);
     }
 
     if (!powers[state.getHiddenPower()])
     {
-        return false;
+        return reject(FilterStage::HiddenPower);
     }
 
     if (shiny != 255 && !(shiny & state.getShiny()))
     {
-        return false;
+        return reject(FilterStage::Shiny);
     }
 
     for (int i = 0; i < 6; i++)
@@ -183,7 +221,7 @@ bool WildStateFilter::compareState(const WildGeneratorState &state) const
         u8 iv = state.getIV(i);
         if (iv < min[i] || iv > max[i])
         {
-            return false;
+            return reject(FilterStage::IV);
         }
     }
 
@@ -192,24 +230,29 @@ bool WildStateFilter::compareState(const WildGeneratorState &state) const
 
 bool WildStateFilter::compareState(const WildSearcherState &state) const
 {
+    if (telemetry)
+    {
+        telemetry->addCandidate();
+    }
+
     if (ability != 255 && ability != state.getAbility())
     {
-        return false;
+        return reject(FilterStage::Ability);
     }
 
     if (gender != 255 && gender != state.getGender())
     {
-        return false;
+        return reject(FilterStage::Gender);
     }
 
     if (!powers[state.getHiddenPower()])
     {
-        return false;
+        return reject(FilterStage::HiddenPower);
     }
 
     if (shiny != 255 && !(shiny & state.getShiny()))
     {
-        return false;
+        return reject(FilterStage::Shiny);
     }
 
     return true;
@@ -217,5 +260,6 @@ bool WildStateFilter::compareState(const WildSearcherState &state) const
 
 bool WildStateFilter::compareState(const WildState &state) const
 {
-    return StateFilter::compareState(static_cast<const State &>(state)) && encounterSlots[state.getEncounterSlot()];
+    return StateFilter::compareState(static_cast<const State &>(state))
+        && (encounterSlots[state.getEncounterSlot()] || reject(FilterStage::EncounterSlot));
 }
@@ -23,11 +23,13 @@
 #include <Core/Global.hpp>
 #include <array>
 
+class SearchTelemetry;
 class SearcherState;
 class State;
 class WildGeneratorState;
 class WildSearcherState;
 class WildState;
+enum class FilterStage : u8;
 
 /**
  * @brief Provides ways to determine if the given \ref State meets the given criteria
@@ -132,15 +134,32 @@ public:
      */
     bool compareState(const State &state) const;
 
+    /**
+     * @brief Sets the telemetry that rejected states are counted in
+     *
+     * @param telemetry Search telemetry, nullptr to stop counting
+     */
+    void setTelemetry(SearchTelemetry *telemetry);
+
 protected:
     std::array<bool, 25> natures;
     std::array<bool, 16> powers;
     std::array<u8, 6> max;
     std::array<u8, 6> min;
+    SearchTelemetry *telemetry;
     bool skip;
     u8 ability;
     u8 gender;
     u8 shiny;
+
+    /**
+     * @brief Counts a state rejected by the filter \p stage
+     *
+     * @param stage Filter stage that rejected the state
+     *
+     * @return Always false
+     */
+    bool reject(FilterStage stage) const;
 };
 
 /**
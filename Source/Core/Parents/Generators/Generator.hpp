@@ -23,6 +23,7 @@
 #include <Core/Global.hpp>
 #include <vector>
 
+class SearchTelemetry;
 enum class Method : u8;
 
 /**
@@ -56,6 +57,19 @@ public:
     {
     }
 
+    /**
+     * @brief Sets the telemetry that the filter counts rejected states in, if the filter supports it
+     *
+     * @param telemetry Search telemetry
+     */
+    void setTelemetry(SearchTelemetry *telemetry)
+    {
+        if constexpr (requires(Filter &filter) { filter.setTelemetry(telemetry); })
+        {
+            filter.setTelemetry(telemetry);
+        }
+    }
+
 protected:
     Profile profile;
     u32 initialAdvances;
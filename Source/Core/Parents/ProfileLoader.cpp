@@ -24,49 +24,253 @@
 #include <Core/Gen4/Profile4.hpp>
 #include <Core/Gen5/Profile5.hpp>
 #include <Core/Gen8/Profile8.hpp>
+#include <condition_variable>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <json.hpp>
+#include <mutex>
+#include <thread>
 
 using json = nlohmann::json;
 
-static std::filesystem::path path;
-
 /**
- * @brief Reads provided profiles file
- *
- * @return json object with profile information
+ * @brief Keeps the profiles file in memory and writes modifications back to disk from a background thread
  */
-static json readJson()
+class ProfileStore
 {
-    json j;
+public:
+    /**
+     * @brief Destroy the ProfileStore object, writing any pending modifications
+     */
+    ~ProfileStore()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        modified.notify_all();
+
+        if (writer.joinable())
+        {
+            writer.join();
+        }
+        flush();
+    }
+
+    /**
+     * @brief Writes pending modifications to the profiles file
+     */
+    void flush()
+    {
+        std::lock_guard<std::mutex> fileLock(fileMutex);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!dirty)
+        {
+            return;
+        }
+
+        std::string data = profiles.dump();
+        std::filesystem::path target = path;
+        dirty = false;
+        lock.unlock();
+
+        // Write to a temporary file first so the profiles file is never left partially written
+        std::filesystem::path temp = target;
+        temp += ".tmp";
+
+        std::ofstream write(temp, std::ios::binary | std::ios::trunc);
+        write << data;
+        write.close();
+
+        std::error_code error;
+        if (write.fail())
+        {
+            std::filesystem::remove(temp, error);
+        }
+        else
+        {
+            std::filesystem::rename(temp, target, error);
+        }
+    }
+
+    /**
+     * @brief Reads the profiles file at \p location after writing any pending modifications of the current file
+     *
+     * @param location Location of profiles json file
+     */
+    void load(const std::filesystem::path &location)
+    {
+        flush();
+
+        json j;
+        std::ifstream read(location);
+        if (read.is_open())
+        {
+            j = json::parse(read, nullptr, false);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        path = location;
+        profiles = j.is_discarded() ? json() : std::move(j);
+    }
 
-    std::ifstream read(path);
-    if (read.is_open())
+    /**
+     * @brief Modifies the profiles and schedules them to be written
+     *
+     * @param function Function that modifies the profiles and returns whether anything changed
+     */
+    void modify(const std::function<bool(json &)> &function)
     {
-        j = json::parse(read, nullptr, false);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!function(profiles))
+            {
+                return;
+            }
+
+            dirty = true;
+            if (!writer.joinable())
+            {
+                writer = std::thread([this] { run(); });
+            }
+        }
+        modified.notify_all();
+    }
+
+    /**
+     * @brief Reads from the profiles
+     *
+     * @param function Function that reads the profiles
+     */
+    void read(const std::function<void(const json &)> &function)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        function(profiles);
+    }
+
+private:
+    std::condition_variable modified;
+    std::filesystem::path path;
+    json profiles;
+    std::mutex fileMutex;
+    std::mutex mutex;
+    std::thread writer;
+    bool dirty = false;
+    bool stop = false;
+
+    /**
+     * @brief Writes the profiles once they have not been modified for a short time, so that a burst of modifications
+     * results in a single write
+     */
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stop)
+        {
+            modified.wait(lock, [this] { return dirty || stop; });
+            while (!stop && modified.wait_for(lock, std::chrono::milliseconds(250)) == std::cv_status::no_timeout)
+            {
+            }
+
+            lock.unlock();
+            flush();
+            lock.lock();
+        }
     }
+};
+
+static ProfileStore store;
 
-    return j.is_discarded() ? json() : j;
+/**
+ * @brief Converts the profiles stored under the \p key to profile objects
+ *
+ * @tparam Profile Profile class
+ * @param key Generation key of the profiles
+ * @param getProfile Converts JSON data to profile
+ *
+ * @return Vector of profiles
+ */
+template <class Profile>
+static std::vector<Profile> readProfiles(const std::string &key, Profile (*getProfile)(const json &))
+{
+    std::vector<Profile> profiles;
+    store.read([&](const json &j) {
+        if (j.is_object() && j.contains(key))
+        {
+            const auto &generation = j[key];
+            std::transform(generation.begin(), generation.end(), std::back_inserter(profiles), getProfile);
+        }
+    });
+    return profiles;
+}
+
+/**
+ * @brief Removes the first profile stored under the \p key that matches \p remove
+ *
+ * @tparam Profile Profile class
+ * @param key Generation key of the profiles
+ * @param remove Profile being removed
+ * @param getProfile Converts JSON data to profile
+ */
+template <class Profile>
+static void removeProfile(const std::string &key, const Profile &remove, Profile (*getProfile)(const json &))
+{
+    store.modify([&](json &j) {
+        auto &generation = j[key];
+        for (size_t i = 0; i < generation.size(); i++)
+        {
+            if (getProfile(generation[i]) == remove)
+            {
+                generation.erase(i);
+                return true;
+            }
+        }
+        return false;
+    });
 }
 
 /**
- * @brief Writes json object with profile information to profiles file
+ * @brief Replaces the first profile stored under the \p key that matches \p original
  *
- * @param j json object with profile information
+ * @tparam Profile Profile class
+ * @param key Generation key of the profiles
+ * @param update Profile with new modifications
+ * @param original Profile being edited
+ * @param getProfile Converts JSON data to profile
+ * @param getJson Converts profile to JSON
  */
-static void writeJson(const json &j)
+template <class Profile>
+static void updateProfile(const std::string &key, const Profile &update, const Profile &original, Profile (*getProfile)(const json &),
+                          json (*getJson)(const Profile &))
 {
-    std::ofstream write(path);
-    write << j.dump();
-    write.close();
+    if (update != original)
+    {
+        store.modify([&](json &j) {
+            for (auto &i : j[key])
+            {
+                if (getProfile(i) == original)
+                {
+                    i = getJson(update);
+                    return true;
+                }
+            }
+            return false;
+        });
+    }
 }
 
 namespace ProfileLoader
 {
+    void flush()
+    {
+        store.flush();
+    }
+
     bool init(const std::wstring &location)
     {
-        path = std::filesystem::path(location);
+        std::filesystem::path path(location);
 
         bool exists = std::filesystem::exists(path);
         if (!exists)
@@ -76,6 +280,7 @@ namespace ProfileLoader
             json.close();
         }
 
+        store.load(path);
         return exists;
     }
 }
@@ -122,54 +327,25 @@ namespace ProfileLoader3
 
     void addProfile(const Profile3 &profile)
     {
-        json j = readJson();
-        auto &gen3 = j["gen3"];
-        gen3.emplace_back(getJson(profile));
-        writeJson(j);
+        store.modify([&profile](json &j) {
+            j["gen3"].emplace_back(getJson(profile));
+            return true;
+        });
     }
 
     std::vector<Profile3> getProfiles()
     {
-        std::vector<Profile3> profiles;
-        json j = readJson();
-        const auto &gen3 = j["gen3"];
-        std::transform(gen3.begin(), gen3.end(), std::back_inserter(profiles), [](const json &j) { return getProfile(j); });
-        return profiles;
+        return readProfiles("gen3", &getProfile);
     }
 
     void removeProfile(const Profile3 &remove)
     {
-        json j = readJson();
-        auto &gen3 = j["gen3"];
-        for (size_t i = 0; i < gen3.size(); i++)
-        {
-            Profile3 profile = getProfile(gen3[i]);
-            if (profile == remove)
-            {
-                gen3.erase(i);
-                writeJson(j);
-                break;
-            }
-        }
+        ::removeProfile("gen3", remove, &getProfile);
     }
 
     void updateProfile(const Profile3 &update, const Profile3 &original)
     {
-        if (update != original)
-        {
-            json j = readJson();
-            auto &gen3 = j["gen3"];
-            for (auto &i : gen3)
-            {
-                Profile3 profile = getProfile(i);
-                if (profile == original)
-                {
-                    i = getJson(update);
-                    writeJson(j);
-                    break;
-                }
-            }
-        }
+        ::updateProfile("gen3", update, original, &getProfile, &getJson);
     }
 }
 
@@ -222,54 +398,25 @@ namespace ProfileLoader4
 
     std::vector<Profile4> getProfiles()
     {
-        std::vector<Profile4> profiles;
-        json j = readJson();
-        const auto &gen4 = j["gen4"];
-        std::transform(gen4.begin(), gen4.end(), std::back_inserter(profiles), [](const json &j) { return getProfile(j); });
-        return profiles;
+        return readProfiles("gen4", &getProfile);
     }
 
     void addProfile(const Profile4 &profile)
     {
-        json j = readJson();
-        auto &gen4 = j["gen4"];
-        gen4.emplace_back(getJson(profile));
-        writeJson(j);
+        store.modify([&profile](json &j) {
+            j["gen4"].emplace_back(getJson(profile));
+            return true;
+        });
     }
 
     void removeProfile(const Profile4 &remove)
     {
-        json j = readJson();
-        auto &gen4 = j["gen4"];
-        for (size_t i = 0; i < gen4.size(); i++)
-        {
-            Profile4 profile = getProfile(gen4[i]);
-            if (profile == remove)
-            {
-                gen4.erase(i);
-                writeJson(j);
-                break;
-            }
-        }
+        ::removeProfile("gen4", remove, &getProfile);
     }
 
     void updateProfile(const Profile4 &update, const Profile4 &original)
     {
-        if (update != original)
-        {
-            json j = readJson();
-            auto &gen4 = j["gen4"];
-            for (auto &i : gen4)
-            {
-                Profile4 profile = getProfile(i);
-                if (profile == original)
-                {
-                    i = getJson(update);
-                    writeJson(j);
-                    break;
-                }
-            }
-        }
+        ::updateProfile("gen4", update, original, &getProfile, &getJson);
     }
 }
 
@@ -355,54 +502,25 @@ namespace ProfileLoader5
 
     void addProfile(const Profile5 &profile)
     {
-        json j = readJson();
-        auto &gen5 = j["gen5"];
-        gen5.emplace_back(getJson(profile));
-        writeJson(j);
+        store.modify([&profile](json &j) {
+            j["gen5"].emplace_back(getJson(profile));
+            return true;
+        });
     }
 
     std::vector<Profile5> getProfiles()
     {
-        std::vector<Profile5> profiles;
-        json j = readJson();
-        const auto &gen5 = j["gen5"];
-        std::transform(gen5.begin(), gen5.end(), std::back_inserter(profiles), [](const json &j) { return getProfile(j); });
-        return profiles;
+        return readProfiles("gen5", &getProfile);
     }
 
     void removeProfile(const Profile5 &remove)
     {
-        json j = readJson();
-        auto &gen5 = j["gen5"];
-        for (size_t i = 0; i < gen5.size(); i++)
-        {
-            Profile5 profile = getProfile(gen5[i]);
-            if (profile == remove)
-            {
-                gen5.erase(i);
-                writeJson(j);
-                break;
-            }
-        }
+        ::removeProfile("gen5", remove, &getProfile);
     }
 
     void updateProfile(const Profile5 &update, const Profile5 &original)
     {
-        if (update != original)
-        {
-            json j = readJson();
-            auto &gen5 = j["gen5"];
-            for (auto &i : gen5)
-            {
-                Profile5 profile = getProfile(i);
-                if (profile == original)
-                {
-                    i = getJson(update);
-                    writeJson(j);
-                    break;
-                }
-            }
-        }
+        ::updateProfile("gen5", update, original, &getProfile, &getJson);
     }
 }
 
@@ -452,53 +570,24 @@ namespace ProfileLoader8
 
     void addProfile(const Profile8 &profile)
     {
-        json j = readJson();
-        auto &gen8 = j["gen8"];
-        gen8.emplace_back(getJson(profile));
-        writeJson(j);
+        store.modify([&profile](json &j) {
+            j["gen8"].emplace_back(getJson(profile));
+            return true;
+        });
     }
 
     std::vector<Profile8> getProfiles()
     {
-        std::vector<Profile8> profiles;
-        json j = readJson();
-        const auto &gen8 = j["gen8"];
-        std::transform(gen8.begin(), gen8.end(), std::back_inserter(profiles), [](const json &j) { return getProfile(j); });
-        return profiles;
+        return readProfiles("gen8", &getProfile);
     }
 
     void removeProfile(const Profile8 &remove)
     {
-        json j = readJson();
-        auto &gen8 = j["gen8"];
-        for (size_t i = 0; i < gen8.size(); i++)
-        {
-            Profile8 profile = getProfile(gen8[i]);
-            if (profile == remove)
-            {
-                gen8.erase(i);
-                writeJson(j);
-                break;
-            }
-        }
+        ::removeProfile("gen8", remove, &getProfile);
     }
 
     void updateProfile(const Profile8 &update, const Profile8 &original)
     {
-        if (update != original)
-        {
-            json j = readJson();
-            auto &gen8 = j["gen8"];
-            for (auto &i : gen8)
-            {
-                Profile8 profile = getProfile(i);
-                if (profile == original)
-                {
-                    i = getJson(update);
-                    writeJson(j);
-                    break;
-                }
-            }
-        }
+        ::updateProfile("gen8", update, original, &getProfile, &getJson);
     }
 }
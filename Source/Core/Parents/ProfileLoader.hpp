@@ -31,7 +31,14 @@ class Profile8;
 namespace ProfileLoader
 {
     /**
-     * @brief Initializes the ProfileLoader with the location to read/write profiles from
+     * @brief Writes pending profile modifications to the profiles file.
+     * Modifications are otherwise written shortly after they are made from a background thread.
+     */
+    void flush();
+
+    /**
+     * @brief Initializes the ProfileLoader with the location to read/write profiles from.
+     * Profiles are read once and kept in memory until the next call.
      *
      * @param location Location of profiles json file
      *
@@ -0,0 +1,268 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef RESULTEXPORTER_HPP
+#define RESULTEXPORTER_HPP
+
+#include <Core/Parents/Searchers/Searcher.hpp>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+/**
+ * @brief Formats that search results can be exported to
+ */
+enum class ExportFormat : u8
+{
+    CSV,
+    Binary
+};
+
+/**
+ * @brief Describes a column of exported search results
+ *
+ * @tparam Row Row class that the column reads from
+ */
+template <class Row>
+struct ResultColumn
+{
+    std::string name;
+    u8 size;
+    std::function<u64(const Row &)> value;
+};
+
+/**
+ * @brief Writes the results of a running search straight to a file so that they never accumulate in memory.
+ *
+ * The searcher is limited to a fixed number of uncollected results, so the search pauses whenever the file writes fall
+ * behind. The binary format starts with a header describing the columns followed by blocks of results, where each block
+ * stores the row count and then every column contiguously using the column size in bytes.
+ *
+ * Searchers that store compact results can export full rows by giving a conversion, which is applied to one batch of
+ * results at a time. Results that the conversion cannot turn into a row are skipped and counted.
+ *
+ * @tparam Result Result class that is generated by the searcher
+ * @tparam Row Row class that the columns read from
+ */
+template <class Result, class Row = Result>
+class ResultExporter
+{
+public:
+    /**
+     * @brief Construct a new ResultExporter object
+     *
+     * @param searcher Searcher to export the results of
+     * @param columns Columns to export
+     * @param format Export format
+     * @param limit Maximum number of results waiting to be written
+     * @param convert Converts a result to the row that is exported, or an empty optional to skip the result. Required when
+     * the row class differs from the result class.
+     */
+    ResultExporter(SearcherBase<Result> &searcher, const std::vector<ResultColumn<Row>> &columns, ExportFormat format,
+                   size_t limit = 0x10000, const std::function<std::optional<Row>(const Result &)> &convert = {}) :
+        searcher(searcher), columns(columns), convert(convert), count(0), skipped(0), limit(limit), running(false), format(format)
+    {
+    }
+
+    /**
+     * @brief Destroy the ResultExporter object, finishing the export if it is still running
+     */
+    ~ResultExporter()
+    {
+        finish();
+    }
+
+    /**
+     * @brief Finishes the export after the search completes, writing any remaining results
+     */
+    void finish()
+    {
+        if (running)
+        {
+            running = false;
+            writer.join();
+
+            write(searcher.getResults());
+            searcher.setResultLimit(0);
+            file.close();
+        }
+    }
+
+    /**
+     * @brief Returns the number of results written
+     *
+     * @return Result count
+     */
+    u64 getCount() const
+    {
+        return count;
+    }
+
+    /**
+     * @brief Returns the number of results that were skipped because they could not be converted to a row
+     *
+     * @return Skipped result count
+     */
+    u64 getSkipped() const
+    {
+        return skipped;
+    }
+
+    /**
+     * @brief Opens the file and starts writing results. Must be called before the search is started.
+     *
+     * @param path File to write to
+     *
+     * @return true Export was started
+     * @return false File could not be opened
+     */
+    bool start(const std::string &path)
+    {
+        file.open(path, format == ExportFormat::CSV ? std::ios::out : std::ios::out | std::ios::binary);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        if (format == ExportFormat::CSV)
+        {
+            for (size_t i = 0; i < columns.size(); i++)
+            {
+                file << (i == 0 ? "" : ",") << columns[i].name;
+            }
+            file << '\n';
+        }
+        else
+        {
+            u32 header[3] = { 0x43524650, 1, static_cast<u32>(columns.size()) }; // PFRC
+            file.write(reinterpret_cast<const char *>(header), sizeof(header));
+            for (const auto &column : columns)
+            {
+                u8 length = column.name.size();
+                file.put(column.size);
+                file.put(length);
+                file.write(column.name.data(), length);
+            }
+        }
+
+        searcher.setResultLimit(limit);
+        running = true;
+        writer = std::thread([this] {
+            while (running)
+            {
+                write(searcher.waitForResults(std::chrono::milliseconds(100)));
+            }
+        });
+
+        return true;
+    }
+
+private:
+    SearcherBase<Result> &searcher;
+    std::vector<ResultColumn<Row>> columns;
+    std::function<std::optional<Row>(const Result &)> convert;
+    std::ofstream file;
+    std::thread writer;
+    std::atomic<u64> count;
+    std::atomic<u64> skipped;
+    size_t limit;
+    std::atomic<bool> running;
+    ExportFormat format;
+
+    /**
+     * @brief Writes a batch of results to the file
+     *
+     * @param results Results to write
+     */
+    void write(const std::vector<Result> &results)
+    {
+        if constexpr (std::is_same_v<Result, Row>)
+        {
+            writeRows(results);
+        }
+        else
+        {
+            std::vector<Row> rows;
+            rows.reserve(results.size());
+            for (const auto &result : results)
+            {
+                if (auto row = convert(result))
+                {
+                    rows.emplace_back(std::move(*row));
+                }
+                else
+                {
+                    skipped++;
+                }
+            }
+            writeRows(rows);
+        }
+    }
+
+    /**
+     * @brief Writes a batch of rows to the file
+     *
+     * @param results Rows to write
+     */
+    void writeRows(const std::vector<Row> &results)
+    {
+        if (results.empty())
+        {
+            return;
+        }
+
+        if (format == ExportFormat::CSV)
+        {
+            for (const auto &result : results)
+            {
+                for (size_t i = 0; i < columns.size(); i++)
+                {
+                    file << (i == 0 ? "" : ",") << columns[i].value(result);
+                }
+                file << '\n';
+            }
+        }
+        else
+        {
+            u32 rows = results.size();
+            file.write(reinterpret_cast<const char *>(&rows), sizeof(rows));
+
+            std::vector<char> block;
+            for (const auto &column : columns)
+            {
+                block.resize(rows * column.size);
+                for (u32 i = 0; i < rows; i++)
+                {
+                    u64 value = column.value(results[i]);
+                    std::memcpy(&block[i * column.size], &value, column.size);
+                }
+                file.write(block.data(), block.size());
+            }
+        }
+
+        count += results.size();
+    }
+};
+
+#endif // RESULTEXPORTER_HPP
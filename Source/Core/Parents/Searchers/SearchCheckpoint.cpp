@@ -0,0 +1,147 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SearchCheckpoint.hpp"
+#include <bit>
+#include <filesystem>
+#include <fstream>
+
+constexpr u32 magic = 0x50434650; // PFCP
+constexpr u32 version = 2;
+
+SearchCheckpoint::SearchCheckpoint(u32 units, u32 size) : done((units + 7) / 8, 0), completed(0), saved(0), size(size), units(units)
+{
+}
+
+void SearchCheckpoint::complete(u32 unit, const void *results, size_t bytes)
+{
+    if (!isComplete(unit))
+    {
+        done[unit >> 3] |= 1 << (unit & 7);
+        completed++;
+        const u8 *begin = static_cast<const u8 *>(results);
+        data.insert(data.end(), begin, begin + bytes);
+    }
+}
+
+u32 SearchCheckpoint::getCompleted() const
+{
+    return completed;
+}
+
+bool SearchCheckpoint::isComplete(u32 unit) const
+{
+    return done[unit >> 3] & (1 << (unit & 7));
+}
+
+bool SearchCheckpoint::isDirty(u32 interval) const
+{
+    return completed - saved >= interval;
+}
+
+bool SearchCheckpoint::load(const std::string &path, u64 key)
+{
+    std::ifstream read(path, std::ios::binary);
+    if (!read.is_open())
+    {
+        return false;
+    }
+
+    u32 header[4];
+    u64 savedKey;
+    read.read(reinterpret_cast<char *>(header), sizeof(header));
+    read.read(reinterpret_cast<char *>(&savedKey), sizeof(savedKey));
+    if (!read || header[0] != magic || header[1] != version || header[2] != units || header[3] != size || savedKey != key)
+    {
+        return false;
+    }
+
+    std::vector<u8> bits(done.size());
+    u64 bytes;
+    read.read(reinterpret_cast<char *>(bits.data()), bits.size());
+    read.read(reinterpret_cast<char *>(&bytes), sizeof(bytes));
+    if (!read || bytes % size != 0)
+    {
+        return false;
+    }
+
+    std::vector<u8> results(bytes);
+    read.read(reinterpret_cast<char *>(results.data()), bytes);
+    if (!read)
+    {
+        return false;
+    }
+
+    done = std::move(bits);
+    data = std::move(results);
+    completed = 0;
+    for (u8 bit : done)
+    {
+        completed += std::popcount(bit);
+    }
+    saved = completed;
+
+    return true;
+}
+
+bool SearchCheckpoint::save(const std::string &path, u64 key)
+{
+    std::string temp = path + ".tmp";
+    {
+        std::ofstream write(temp, std::ios::binary | std::ios::trunc);
+        if (!write.is_open())
+        {
+            return false;
+        }
+
+        u32 header[4] = { magic, version, units, size };
+        u64 bytes = data.size();
+        write.write(reinterpret_cast<const char *>(header), sizeof(header));
+        write.write(reinterpret_cast<const char *>(&key), sizeof(key));
+        write.write(reinterpret_cast<const char *>(done.data()), done.size());
+        write.write(reinterpret_cast<const char *>(&bytes), sizeof(bytes));
+        write.write(reinterpret_cast<const char *>(data.data()), bytes);
+        if (!write)
+        {
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temp, path, error);
+    if (error)
+    {
+        return false;
+    }
+
+    saved = completed;
+    return true;
+}
+
+u64 SearchCheckpoint::hash(const void *data, size_t size)
+{
+    // FNV-1a
+    u64 hash = 0xcbf29ce484222325;
+    const u8 *bytes = reinterpret_cast<const u8 *>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ bytes[i]) * 0x100000001b3;
+    }
+    return hash;
+}
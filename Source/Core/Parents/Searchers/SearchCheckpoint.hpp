@@ -0,0 +1,164 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEARCHCHECKPOINT_HPP
+#define SEARCHCHECKPOINT_HPP
+
+#include <Core/Global.hpp>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Tracks which work units of a long running search are complete along with their results so the search can be
+ * stopped and resumed later. The saved file acts as the resume token. Results are stored as raw bytes and must be
+ * trivially copyable.
+ *
+ * The class is not thread safe, callers are expected to hold the searcher mutex.
+ */
+class SearchCheckpoint
+{
+public:
+    /**
+     * @brief Construct a new SearchCheckpoint object
+     *
+     * @param units Total number of work units in the search
+     * @param size Size in bytes of a single result
+     */
+    SearchCheckpoint(u32 units, u32 size = sizeof(u32));
+
+    /**
+     * @brief Marks a work unit as complete and records the results it found
+     *
+     * @tparam Result Result class
+     * @param unit Work unit index
+     * @param results Results found in the work unit
+     */
+    template <class Result>
+    void complete(u32 unit, const std::vector<Result> &results)
+    {
+        static_assert(std::is_trivially_copyable_v<Result>, "Checkpoint results are stored as raw bytes");
+        complete(unit, results.data(), results.size() * sizeof(Result));
+    }
+
+    /**
+     * @brief Returns the number of completed work units
+     *
+     * @return Completed work units
+     */
+    u32 getCompleted() const;
+
+    /**
+     * @brief Returns the results of every completed work unit
+     *
+     * @tparam Result Result class
+     *
+     * @return Vector of results
+     */
+    template <class Result>
+    std::vector<Result> getResults() const
+    {
+        static_assert(std::is_trivially_copyable_v<Result>, "Checkpoint results are stored as raw bytes");
+        std::vector<Result> results;
+        results.reserve(data.size() / sizeof(Result));
+        for (size_t i = 0; i + sizeof(Result) <= data.size(); i += sizeof(Result))
+        {
+            std::array<u8, sizeof(Result)> bytes;
+            std::memcpy(bytes.data(), &data[i], sizeof(Result));
+            results.emplace_back(std::bit_cast<Result>(bytes));
+        }
+        return results;
+    }
+
+    /**
+     * @brief Returns whether a work unit has already been completed
+     *
+     * @param unit Work unit index
+     *
+     * @return true Work unit is complete
+     * @return false Work unit is not complete
+     */
+    bool isComplete(u32 unit) const;
+
+    /**
+     * @brief Returns whether the checkpoint has unsaved progress that should be written
+     *
+     * @param interval Number of completed work units between saves
+     *
+     * @return true Checkpoint should be saved
+     * @return false Checkpoint is up to date
+     */
+    bool isDirty(u32 interval) const;
+
+    /**
+     * @brief Loads a previously saved checkpoint. The checkpoint is left untouched if the file does not exist or was saved
+     * for a different search.
+     *
+     * @param path File to read from
+     * @param key Identifier of the search parameters
+     *
+     * @return true Checkpoint was loaded
+     * @return false Checkpoint was not loaded
+     */
+    bool load(const std::string &path, u64 key);
+
+    /**
+     * @brief Saves the checkpoint. The file is written to a temporary location first so an interrupted save never
+     * corrupts an existing checkpoint.
+     *
+     * @param path File to write to
+     * @param key Identifier of the search parameters
+     *
+     * @return true Checkpoint was saved
+     * @return false Checkpoint was not saved
+     */
+    bool save(const std::string &path, u64 key);
+
+    /**
+     * @brief Computes a search parameter identifier from raw bytes
+     *
+     * @param data Bytes to hash
+     * @param size Number of bytes
+     *
+     * @return Identifier of the search parameters
+     */
+    static u64 hash(const void *data, size_t size);
+
+private:
+    std::vector<u8> data;
+    std::vector<u8> done;
+    u32 completed;
+    u32 saved;
+    u32 size;
+    u32 units;
+
+    /**
+     * @brief Marks a work unit as complete and records the raw bytes of the results it found
+     *
+     * @param unit Work unit index
+     * @param results Results found in the work unit
+     * @param bytes Number of bytes of results
+     */
+    void complete(u32 unit, const void *results, size_t bytes);
+};
+
+#endif // SEARCHCHECKPOINT_HPP
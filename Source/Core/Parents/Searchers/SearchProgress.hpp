@@ -0,0 +1,118 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEARCHPROGRESS_HPP
+#define SEARCHPROGRESS_HPP
+
+#include <Core/Global.hpp>
+#include <array>
+#include <atomic>
+
+/**
+ * @brief Progress counter of a search that is split into cache line sized shards. Each thread counts into its own shard so
+ * threads never write to the same cache line, and the shards are only summed when the progress is read.
+ *
+ * Hot loops should still count locally and add to the counter in batches.
+ */
+class SearchProgress
+{
+public:
+    /**
+     * @brief Construct a new SearchProgress object
+     */
+    SearchProgress()
+    {
+        *this = 0;
+    }
+
+    /**
+     * @brief Adds to the progress from the calling thread
+     *
+     * @param amount Progress to add
+     *
+     * @return Reference to this counter
+     */
+    SearchProgress &operator+=(u64 amount)
+    {
+        shards[getShard()].count.fetch_add(amount, std::memory_order_relaxed);
+        return *this;
+    }
+
+    /**
+     * @brief Adds one to the progress from the calling thread
+     */
+    void operator++(int)
+    {
+        *this += 1;
+    }
+
+    /**
+     * @brief Replaces the progress. This should not be used while other threads are adding to it.
+     *
+     * @param value New progress
+     *
+     * @return Reference to this counter
+     */
+    SearchProgress &operator=(u64 value)
+    {
+        for (auto &shard : shards)
+        {
+            shard.count.store(0, std::memory_order_relaxed);
+        }
+        shards[0].count.store(value, std::memory_order_relaxed);
+        return *this;
+    }
+
+    /**
+     * @brief Returns the progress summed across all threads
+     *
+     * @return Progress
+     */
+    u64 get() const
+    {
+        u64 total = 0;
+        for (const auto &shard : shards)
+        {
+            total += shard.count.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+private:
+    struct alignas(64) Shard
+    {
+        std::atomic<u64> count;
+    };
+
+    std::array<Shard, 16> shards;
+
+    /**
+     * @brief Returns the shard of the calling thread. Threads are given shards in the order they first count progress.
+     *
+     * @return Shard index
+     */
+    static size_t getShard()
+    {
+        static std::atomic<u32> next = 0;
+        thread_local size_t shard = next++ % 16;
+        return shard;
+    }
+};
+
+#endif // SEARCHPROGRESS_HPP
@@ -0,0 +1,264 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEARCHTELEMETRY_HPP
+#define SEARCHTELEMETRY_HPP
+
+#include <Core/Global.hpp>
+#include <Core/Parents/Searchers/SearchProgress.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Filter checks that can reject a state
+ */
+enum class FilterStage : u8
+{
+    Ability,
+    Gender,
+    HiddenPower,
+    Nature,
+    Shiny,
+    IV,
+    EncounterSlot
+};
+
+constexpr size_t FilterStageCount = static_cast<size_t>(FilterStage::EncounterSlot) + 1;
+
+/**
+ * @brief Copy of the telemetry of a search at a point in time
+ */
+struct SearchTelemetrySnapshot
+{
+    std::array<u64, FilterStageCount> rejections;
+    std::vector<double> threadUtilization;
+    double elapsed;
+    double progressRate;
+    double waitTime;
+    u64 candidates;
+    u64 hits;
+    u64 progress;
+};
+
+/**
+ * @brief Opt-in counters that describe where a search spends its time. Counters are sharded like \ref SearchProgress so
+ * threads never contend on them.
+ */
+class SearchTelemetry
+{
+public:
+    /**
+     * @brief Records how long a search thread runs for the lifetime of the object
+     */
+    class ThreadTimer
+    {
+    public:
+        /**
+         * @brief Construct a new ThreadTimer object
+         *
+         * @param telemetry Telemetry to record to, nothing is recorded if this is nullptr
+         */
+        ThreadTimer(SearchTelemetry *telemetry) : telemetry(telemetry), index(telemetry ? telemetry->startThread() : 0)
+        {
+        }
+
+        /**
+         * @brief Destroy the ThreadTimer object, marking the thread as finished
+         */
+        ~ThreadTimer()
+        {
+            if (telemetry)
+            {
+                telemetry->stopThread(index);
+            }
+        }
+
+        ThreadTimer(const ThreadTimer &) = delete;
+        void operator=(const ThreadTimer &) = delete;
+
+    private:
+        SearchTelemetry *telemetry;
+        size_t index;
+    };
+
+    /**
+     * @brief Construct a new SearchTelemetry object, starting the search clock
+     */
+    SearchTelemetry() : start(std::chrono::steady_clock::now())
+    {
+    }
+
+    /**
+     * @brief Adds a state that reached the full filter check
+     */
+    void addCandidate()
+    {
+        candidates++;
+    }
+
+    /**
+     * @brief Adds collected results
+     *
+     * @param count Number of results
+     */
+    void addHits(u64 count)
+    {
+        hits += count;
+    }
+
+    /**
+     * @brief Adds a state rejected by the filter \p stage
+     *
+     * @param stage Filter stage
+     */
+    void addRejection(FilterStage stage)
+    {
+        rejections[static_cast<size_t>(stage)]++;
+    }
+
+    /**
+     * @brief Marks the calling thread as waiting for its results to be collected
+     */
+    void startWait()
+    {
+        currentWaitStart = std::chrono::steady_clock::now();
+        if (currentTelemetry == this)
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            threads[currentThread].waitStart = currentWaitStart;
+            threads[currentThread].waiting = true;
+        }
+    }
+
+    /**
+     * @brief Marks the calling thread as done waiting, adding the time since \ref startWait to the wait time. The wait is also
+     * charged to the calling thread if it is timed by a \ref ThreadTimer of this telemetry.
+     */
+    void stopWait()
+    {
+        auto duration = std::chrono::steady_clock::now() - currentWaitStart;
+        waitTime += std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        if (currentTelemetry == this)
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            threads[currentThread].wait += duration;
+            threads[currentThread].waiting = false;
+        }
+    }
+
+    /**
+     * @brief Returns a copy of the telemetry
+     *
+     * @param progress Current progress of the search
+     * @param pending Results waiting to be collected
+     *
+     * @return Telemetry snapshot
+     */
+    SearchTelemetrySnapshot getSnapshot(u64 progress, u64 pending) const
+    {
+        auto now = std::chrono::steady_clock::now();
+
+        SearchTelemetrySnapshot snapshot;
+        snapshot.elapsed = std::chrono::duration<double>(now - start).count();
+        snapshot.progress = progress;
+        snapshot.progressRate = snapshot.elapsed > 0 ? progress / snapshot.elapsed : 0;
+        snapshot.candidates = candidates.get();
+        snapshot.hits = hits.get() + pending;
+        snapshot.waitTime = waitTime.get() / 1e9;
+        for (size_t i = 0; i < FilterStageCount; i++)
+        {
+            snapshot.rejections[i] = rejections[i].get();
+        }
+
+        // Time spent blocked on the result limit is not useful work, including a wait that is still going on
+        std::lock_guard<std::mutex> guard(mutex);
+        for (const auto &thread : threads)
+        {
+            auto end = thread.running ? now : thread.end;
+            auto wait = thread.wait;
+            if (thread.waiting)
+            {
+                wait += now - thread.waitStart;
+                snapshot.waitTime += std::chrono::duration<double>(now - thread.waitStart).count();
+            }
+
+            double busy = std::chrono::duration<double>(end - thread.start - wait).count();
+            snapshot.threadUtilization.emplace_back(snapshot.elapsed > 0 ? std::max(busy, 0.0) / snapshot.elapsed : 0);
+        }
+        return snapshot;
+    }
+
+private:
+    struct Thread
+    {
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point end;
+        std::chrono::steady_clock::time_point waitStart;
+        std::chrono::steady_clock::duration wait;
+        bool running;
+        bool waiting;
+    };
+
+    /**
+     * @brief Telemetry and thread index that the calling thread records its waits to, and when its current wait started
+     */
+    static inline thread_local const SearchTelemetry *currentTelemetry = nullptr;
+    static inline thread_local size_t currentThread = 0;
+    static inline thread_local std::chrono::steady_clock::time_point currentWaitStart;
+
+    std::array<SearchProgress, FilterStageCount> rejections;
+    std::vector<Thread> threads;
+    std::chrono::steady_clock::time_point start;
+    mutable std::mutex mutex;
+    SearchProgress candidates;
+    SearchProgress hits;
+    SearchProgress waitTime;
+
+    /**
+     * @brief Marks the calling thread as a started search thread
+     *
+     * @return Index of the thread
+     */
+    size_t startThread()
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        threads.push_back({ std::chrono::steady_clock::now(), {}, {}, {}, true, false });
+        currentTelemetry = this;
+        currentThread = threads.size() - 1;
+        return currentThread;
+    }
+
+    /**
+     * @brief Marks the search thread at \p index as finished
+     *
+     * @param index Index of the thread
+     */
+    void stopThread(size_t index)
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        threads[index].end = std::chrono::steady_clock::now();
+        threads[index].running = false;
+        currentTelemetry = nullptr;
+    }
+};
+
+#endif // SEARCHTELEMETRY_HPP
@@ -21,7 +21,11 @@
 #define SEARCHER_HPP
 
 #include <Core/Global.hpp>
-#include <atomic>
+#include <Core/Parents/Searchers/SearchProgress.hpp>
+#include <Core/Parents/Searchers/SearchTelemetry.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -43,7 +47,7 @@ public:
      * @param profile Profile Information
      * @param filter State filter
      */
-    SearcherBase() : progress(0), searching(false)
+    SearcherBase() : limit(0), searching(false)
     {
     }
 
@@ -52,7 +56,10 @@ public:
      */
     void cancelSearch()
     {
+        // Set under the lock so a thread checking the flag before waiting for space cannot miss the notification
+        std::lock_guard<std::mutex> guard(mutex);
         searching = false;
+        space.notify_all();
     }
 
     /**
@@ -62,7 +69,25 @@ public:
      */
     virtual int getProgress() const
     {
-        return progress;
+        return static_cast<int>(progress.get());
+    }
+
+    /**
+     * @brief Returns the full progress of the running search, for searches that can go past the range of \ref getProgress
+     *
+     * @return Progress
+     */
+    u64 getTotalProgress() const
+    {
+        return progress.get();
+    }
+
+    /**
+     * @brief Starts collecting telemetry for the search. Must be called before the search is started.
+     */
+    virtual void enableTelemetry()
+    {
+        telemetry = std::make_unique<SearchTelemetry>();
     }
 
     /**
@@ -74,14 +99,96 @@ public:
     {
         std::lock_guard<std::mutex> guard(mutex);
         auto data = std::move(results);
+        if (telemetry)
+        {
+            telemetry->addHits(data.size());
+        }
+        space.notify_all();
+        return data;
+    }
+
+    /**
+     * @brief Returns the telemetry of the running search
+     *
+     * @return Telemetry snapshot, all zero if telemetry is not enabled
+     */
+    SearchTelemetrySnapshot getTelemetry()
+    {
+        if (!telemetry)
+        {
+            return SearchTelemetrySnapshot {};
+        }
+
+        std::lock_guard<std::mutex> guard(mutex);
+        return telemetry->getSnapshot(progress.get(), results.size());
+    }
+
+    /**
+     * @brief Limits how many states can be waiting to be collected. Once the limit is hit the search pauses until the states
+     * are collected with \ref getResults or \ref waitForResults. A limit of 0 disables the limit.
+     *
+     * @param limit Maximum number of uncollected states
+     */
+    void setResultLimit(size_t limit)
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        this->limit = limit;
+        space.notify_all();
+    }
+
+    /**
+     * @brief Waits for the running search to compute states and returns them
+     *
+     * @param timeout Maximum time to wait
+     *
+     * @return Vector of computed states, empty if none were computed before the timeout
+     */
+    std::vector<Result> waitForResults(std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        available.wait_for(lock, timeout, [this] { return !results.empty(); });
+        auto data = std::move(results);
+        if (telemetry)
+        {
+            telemetry->addHits(data.size());
+        }
+        space.notify_all();
         return data;
     }
 
 protected:
+    std::condition_variable available;
+    std::condition_variable space;
     std::mutex mutex;
+    std::unique_ptr<SearchTelemetry> telemetry;
     std::vector<Result> results;
-    std::atomic<u32> progress;
+    size_t limit;
+    SearchProgress progress;
     bool searching;
+
+    /**
+     * @brief Locks the states for adding new results. Waits until states are collected if the result limit has been hit.
+     *
+     * @return Lock on the states
+     */
+    std::unique_lock<std::mutex> lockResults()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (limit != 0 && results.size() >= limit && searching)
+        {
+            if (telemetry)
+            {
+                telemetry->startWait();
+            }
+            space.wait(lock, [this] { return limit == 0 || results.size() < limit || !searching; });
+            if (telemetry)
+            {
+                telemetry->stopWait();
+            }
+        }
+        available.notify_one();
+        return lock;
+    }
 };
 
 /**
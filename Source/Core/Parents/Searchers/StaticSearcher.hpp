@@ -48,6 +48,15 @@ public:
     {
     }
 
+    /**
+     * @brief Starts collecting telemetry for the search, including the filter rejections. Must be called before the search is started.
+     */
+    void enableTelemetry() override
+    {
+        SearcherBase<Result>::enableTelemetry();
+        filter.setTelemetry(this->telemetry.get());
+    }
+
 protected:
     Filter filter;
     Lead lead;
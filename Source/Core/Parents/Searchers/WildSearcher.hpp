@@ -50,6 +50,15 @@ public:
     {
     }
 
+    /**
+     * @brief Starts collecting telemetry for the search, including the filter rejections. Must be called before the search is started.
+     */
+    void enableTelemetry() override
+    {
+        SearcherBase<Result>::enableTelemetry();
+        filter.setTelemetry(this->telemetry.get());
+    }
+
 protected:
     EncounterArea area;
     Filter filter;
@@ -0,0 +1,50 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "StatTable.hpp"
+#include <Core/Parents/PersonalInfo.hpp>
+#include <Core/Util/Nature.hpp>
+
+template <bool strength>
+static consteval std::array<u8, 64> computeHiddenPower()
+{
+    std::array<u8, 64> table;
+    for (int i = 0; i < 64; i++)
+    {
+        table[i] = strength ? 30 + (i * 40 / 63) : i * 15 / 63;
+    }
+    return table;
+}
+
+const std::array<u8, 64> StatTable::hiddenPower = computeHiddenPower<false>();
+const std::array<u8, 64> StatTable::hiddenPowerStrength = computeHiddenPower<true>();
+
+StatTable::StatTable(const PersonalInfo *info, u8 level) : info(info), level(level)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        for (u8 nature = 0; nature < 25; nature++)
+        {
+            for (u8 iv = 0; iv < 32; iv++)
+            {
+                stats[i][nature][iv] = Nature::computeStat(info->getStat(i), iv, nature, level, i);
+            }
+        }
+    }
+}
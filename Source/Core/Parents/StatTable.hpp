@@ -0,0 +1,110 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef STATTABLE_HPP
+#define STATTABLE_HPP
+
+#include <Core/Global.hpp>
+#include <array>
+
+class PersonalInfo;
+
+/**
+ * @brief Precomputed stats of a Pokemon at a fixed level for every IV and nature combination.
+ * Generators that produce a single species at a single level build this once so states only need table lookups.
+ */
+class StatTable
+{
+public:
+    /**
+     * @brief Construct a new StatTable object
+     *
+     * @param info Pokemon information
+     * @param level Pokemon level
+     */
+    StatTable(const PersonalInfo *info, u8 level);
+
+    /**
+     * @brief Returns the hidden power type from the lowest bit of each IV
+     *
+     * @param bits Lowest IV bits in hidden power order
+     *
+     * @return Hidden power type
+     */
+    static u8 getHiddenPower(u8 bits)
+    {
+        return hiddenPower[bits];
+    }
+
+    /**
+     * @brief Returns the hidden power strength from the second lowest bit of each IV
+     *
+     * @param bits Second lowest IV bits in hidden power order
+     *
+     * @return Hidden power strength
+     */
+    static u8 getHiddenPowerStrength(u8 bits)
+    {
+        return hiddenPowerStrength[bits];
+    }
+
+    /**
+     * @brief Returns the Pokemon information the table was built from
+     *
+     * @return Pokemon information
+     */
+    const PersonalInfo *getInfo() const
+    {
+        return info;
+    }
+
+    /**
+     * @brief Returns the level the table was built for
+     *
+     * @return Pokemon level
+     */
+    u8 getLevel() const
+    {
+        return level;
+    }
+
+    /**
+     * @brief Returns the stat for the \p iv and \p nature
+     *
+     * @param index Stat index
+     * @param iv Pokemon IV
+     * @param nature Pokemon nature
+     *
+     * @return Computed stat
+     */
+    u16 getStat(int index, u8 iv, u8 nature) const
+    {
+        return stats[index][nature][iv];
+    }
+
+private:
+    static const std::array<u8, 64> hiddenPower;
+    static const std::array<u8, 64> hiddenPowerStrength;
+
+    std::array<std::array<std::array<u16, 32>, 25>, 6> stats;
+    const PersonalInfo *info;
+    u8 level;
+};
+
+#endif // STATTABLE_HPP
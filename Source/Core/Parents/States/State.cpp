@@ -24,6 +24,24 @@ constexpr u8 order[6] = { 0, 1, 2, 5, 3, 4 };
 constexpr u8 charOrder[11] = { 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4 };
 
 void State::updateStats(const PersonalInfo *info)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        stats[i] = Nature::computeStat(info->getStat(i), ivs[i], nature, level, i);
+    }
+    updateIVStats();
+}
+
+void State::updateStats(const StatTable &table)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        stats[i] = table.getStat(i, ivs[i], nature);
+    }
+    updateIVStats();
+}
+
+void State::updateIVStats()
 {
     u8 h = 0;
     u8 p = 0;
@@ -35,8 +53,6 @@ void State::updateStats(const PersonalInfo *info)
         h |= (ivs[order[i]] & 1) << i;
         p |= ((ivs[order[i]] >> 1) & 1) << i;
 
-        stats[i] = Nature::computeStat(info->getStat(i), ivs[i], nature, level, i);
-
         u8 index = charOrder[ecIndex + i];
         if (ivs[order[index]] > maxIV)
         {
@@ -44,7 +60,7 @@ void State::updateStats(const PersonalInfo *info)
             maxIV = ivs[order[index]];
         }
     }
-    hiddenPower = h * 15 / 63;
-    hiddenPowerStrength = 30 + (p * 40 / 63);
+    hiddenPower = StatTable::getHiddenPower(h);
+    hiddenPowerStrength = StatTable::getHiddenPowerStrength(p);
     characteristic = (charIndex * 5) + (maxIV % 5);
 }
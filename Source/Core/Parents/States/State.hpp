@@ -22,6 +22,7 @@
 
 #include <Core/Global.hpp>
 #include <Core/Parents/PersonalInfo.hpp>
+#include <Core/Parents/StatTable.hpp>
 #include <array>
 
 /**
@@ -83,6 +84,31 @@ public:
         updateStats(info);
     }
 
+    /**
+     * @brief Construct a new State object with stats looked up from a precomputed \p table
+     *
+     * @param pid Pokemon PID
+     * @param ivs Pokemon IVs
+     * @param ability Pokemon ability
+     * @param gender Pokemon gender
+     * @param nature Pokemon nature
+     * @param shiny Pokemon shininess
+     * @param table Pokemon stat table
+     */
+    State(u32 pid, const std::array<u8, 6> &ivs, u8 ability, u8 gender, u8 nature, u8 shiny, const StatTable &table) :
+        ec(pid),
+        pid(pid),
+        abilityIndex(table.getInfo()->getAbility(ability)),
+        ivs(ivs),
+        ability(ability),
+        gender(gender),
+        level(table.getLevel()),
+        nature(nature),
+        shiny(shiny)
+    {
+        updateStats(table);
+    }
+
     /**
      * @brief Returns the ability of the pokemon
      *
@@ -258,6 +284,18 @@ protected:
      * @param info Pokemon information
      */
     void updateStats(const PersonalInfo *info);
+
+    /**
+     * @brief Updates characterstic, hidden power, and stats from a precomputed table
+     *
+     * @param table Pokemon stat table
+     */
+    void updateStats(const StatTable &table);
+
+    /**
+     * @brief Updates characterstic and hidden power from the IVs
+     */
+    void updateIVStats();
 };
 
 /**
@@ -305,6 +343,24 @@ public:
     {
     }
 
+    /**
+     * @brief Construct a new GeneratorState object with stats looked up from a precomputed \p table
+     *
+     * @param advances Advances of the state
+     * @param pid Pokemon PID
+     * @param ivs Pokemon IVs
+     * @param ability Pokemon ability
+     * @param gender Pokemon gender
+     * @param nature Pokemon nature
+     * @param shiny Pokemon shininess
+     * @param table Pokemon stat table
+     */
+    GeneratorState(u32 advances, u32 pid, const std::array<u8, 6> &ivs, u8 ability, u8 gender, u8 nature, u8 shiny,
+                   const StatTable &table) :
+        State(pid, ivs, ability, gender, nature, shiny, table), advances(advances)
+    {
+    }
+
     /**
      * @brief Returns the advances of the state
      *
@@ -20,6 +20,7 @@
 #ifndef WILDSTATE_HPP
 #define WILDSTATE_HPP
 
+#include <Core/Enum/Lead.hpp>
 #include <Core/Parents/States/State.hpp>
 
 /**
@@ -201,6 +202,7 @@ public:
      * @brief Construct a new WildSearcherState object
      *
      * @param seed Seed of the state
+     * @param lead Encounter lead of the state
      * @param pid Pokemon PID
      * @param ivs Pokemon IVs
      * @param ability Pokemon ability
@@ -214,12 +216,22 @@ public:
      * @param form Pokemon form
      * @param info Pokemon information
      */
-    WildSearcherState(u32 seed, u32 pid, const std::array<u8, 6> &ivs, u8 ability, u8 gender, u8 level, u8 nature, u8 shiny,
+    WildSearcherState(u32 seed, Lead lead, u32 pid, const std::array<u8, 6> &ivs, u8 ability, u8 gender, u8 level, u8 nature, u8 shiny,
                       u8 encounterSlot, u16 item, u16 specie, u8 form, const PersonalInfo *info) :
-        WildState(pid, ivs, ability, gender, level, nature, shiny, encounterSlot, item, specie, form, info), seed(seed)
+        WildState(pid, ivs, ability, gender, level, nature, shiny, encounterSlot, item, specie, form, info), seed(seed), lead(lead)
     {
     }
 
+    /**
+     * @brief Returns the lead of the state
+     *
+     * @return State lead
+     */
+    Lead getLead() const
+    {
+        return lead;
+    }
+
     /**
      * @brief Returns the seed of the state
      *
@@ -232,6 +244,7 @@ public:
 
 protected:
     u32 seed;
+    Lead lead;
 };
 
 #endif // WILDSTATE_HPP
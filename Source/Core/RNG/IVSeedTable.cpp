@@ -0,0 +1,259 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IVSeedTable.hpp"
+#include <Core/Enum/Method.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+constexpr char magic[4] = { 'P', 'F', 'I', 'V' };
+constexpr u64 headerSize = 8;
+constexpr u64 fileSize = headerSize + 0x80000000ULL * sizeof(u32);
+
+static const u8 *views[2];
+
+/**
+ * @brief Unmaps a table view
+ *
+ * @param view Mapped file
+ */
+static void unmap(const u8 *view)
+{
+#ifdef _WIN32
+    UnmapViewOfFile(view);
+#else
+    munmap(const_cast<u8 *>(view), fileSize);
+#endif
+}
+
+/**
+ * @brief Maps a whole table file as read only
+ *
+ * @param path File to map
+ *
+ * @return Mapped file, or nullptr if the file does not have the size of a table
+ */
+static const u8 *map(const std::filesystem::path &path)
+{
+    if (fileSize > std::numeric_limits<size_t>::max())
+    {
+        return nullptr;
+    }
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || static_cast<u64>(size.QuadPart) != fileSize)
+    {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+    {
+        return nullptr;
+    }
+
+    // The view keeps the mapping alive
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    return static_cast<const u8 *>(view);
+#else
+    int file = open(path.c_str(), O_RDONLY);
+    if (file == -1)
+    {
+        return nullptr;
+    }
+
+    struct stat info;
+    if (fstat(file, &info) != 0 || static_cast<u64>(info.st_size) != fileSize)
+    {
+        close(file);
+        return nullptr;
+    }
+
+    // The mapping stays valid after the file is closed
+    void *view = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, file, 0);
+    close(file);
+    return view == MAP_FAILED ? nullptr : static_cast<const u8 *>(view);
+#endif
+}
+
+namespace IVSeedTable
+{
+    bool build(const std::filesystem::path &path, Method method)
+    {
+        std::ofstream write(path, std::ios::binary | std::ios::trunc);
+        if (!write.is_open())
+        {
+            return false;
+        }
+
+        u32 layout = method == Method::Method4;
+        write.write(magic, sizeof(magic));
+        write.write(reinterpret_cast<const char *>(&layout), sizeof(layout));
+
+        std::vector<u32> block(0x10000);
+        for (u32 first = 0; first < 0x8000 && write.good(); first++)
+        {
+            buildBlock(first & 0x1f, (first >> 5) & 0x1f, first >> 10, block.data(), method);
+            write.write(reinterpret_cast<const char *>(block.data()), block.size() * sizeof(u32));
+        }
+
+        write.close();
+        if (write.fail())
+        {
+            std::error_code error;
+            std::filesystem::remove(path, error);
+            return false;
+        }
+        return true;
+    }
+
+    void buildBlock(u8 hp, u8 atk, u8 def, u32 *block, Method method)
+    {
+        bool gap = method == Method::Method4;
+        u32 mult = gap ? 0xc2a29a69 : 0x41c64e6d;
+        u32 add = gap ? 0xe97e7b6a : 0x6073;
+        u32 first = hp | (atk << 5) | (def << 10);
+
+        // Counting sort the states of the first call by the second call
+        std::vector<u32> counts(0x8001);
+        for (u32 low = 0; low < 0x10000; low++)
+        {
+            u32 second = ((((first << 16) | low) * mult + add) >> 16) & 0x7fff;
+            counts[second + 1]++;
+        }
+
+        for (u32 i = 1; i < counts.size(); i++)
+        {
+            counts[i] += counts[i - 1];
+        }
+
+        for (u32 low = 0; low < 0x10000; low++)
+        {
+            u32 second = ((((first << 16) | low) * mult + add) >> 16) & 0x7fff;
+            block[counts[second]++] = (second << 16) | low;
+        }
+    }
+
+    bool load(const std::filesystem::path &path)
+    {
+        const u8 *view = map(path);
+        if (view == nullptr)
+        {
+            return false;
+        }
+
+        u32 layout;
+        std::memcpy(&layout, view + sizeof(magic), sizeof(layout));
+        if (std::memcmp(view, magic, sizeof(magic)) != 0 || layout > 1)
+        {
+            unmap(view);
+            return false;
+        }
+
+        if (views[layout] != nullptr)
+        {
+            unmap(views[layout]);
+        }
+        views[layout] = view;
+        return true;
+    }
+
+    int recover(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 minSpe, u8 maxSpe, u32 *seeds, int *offsets, Method method)
+    {
+        const u8 *view = views[method == Method::Method4];
+        if (view == nullptr)
+        {
+            return -1;
+        }
+
+        u32 first = hp | (atk << 5) | (def << 10);
+        auto *block = reinterpret_cast<const u32 *>(view + headerSize) + (first << 16);
+        return recover(block, hp, atk, def, spa, spd, minSpe, maxSpe, seeds, offsets);
+    }
+
+    int recover(const u32 *block, u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 minSpe, u8 maxSpe, u32 *seeds, int *offsets)
+    {
+        u32 first = hp | (atk << 5) | (def << 10);
+        u32 row = (spa << 5) | (spd << 10);
+        auto *end = block + 0x10000;
+
+        // Each value of the second call has two states on average, so start from where it would be with an even spread
+        u32 key = (row | minSpe) << 16;
+        auto *guess = block + ((row | minSpe) << 1);
+        auto *low = guess - std::min<u32>(guess - block, 512);
+        auto *high = guess + std::min<u32>(end - guess, 512);
+        if ((low != block && low[-1] >= key) || (high != end && *high < key))
+        {
+            low = block;
+            high = end;
+        }
+        auto *it = std::lower_bound(low, high, key);
+
+        int size = 0;
+        for (u8 spe = minSpe; spe <= maxSpe; spe++)
+        {
+            offsets[spe - minSpe] = size;
+            for (u32 second = row | spe; it != end && (*it >> 16) == second; it++)
+            {
+                u32 seed = (first << 16) | (*it & 0xffff);
+                seeds[size++] = seed;
+                seeds[size++] = seed ^ 0x80000000;
+            }
+        }
+        offsets[maxSpe - minSpe + 1] = size;
+
+        return size;
+    }
+
+    void unload()
+    {
+        for (auto &view : views)
+        {
+            if (view != nullptr)
+            {
+                unmap(view);
+                view = nullptr;
+            }
+        }
+    }
+}
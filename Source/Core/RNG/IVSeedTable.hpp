@@ -0,0 +1,113 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef IVSEEDTABLE_HPP
+#define IVSEEDTABLE_HPP
+
+#include <Core/Global.hpp>
+#include <filesystem>
+
+enum class Method : u8;
+
+/**
+ * @brief Provides an optional precomputed table of the PokeRNG states for every IV combination.
+ *
+ * Each table covers one IV layout (no gap for Method 1/2/J/K, a gap for Method 4). It stores, for each of the 2^15 values of the first IV
+ * call, a 32 bit entry for each of the 2^16 states with that value, sorted by the value of the following IV call. An entry holds that
+ * value in its high 16 bits and the low 16 bits of the state in its low 16 bits, which is what the binary search compares against. The
+ * top bit of the state is not stored since flipping it does not change either IV call. A table is 8 GiB and is memory mapped once
+ * loaded, which lets wide searches read origin seeds for a whole row of Spe ivs with a single binary search instead of recovering them.
+ */
+namespace IVSeedTable
+{
+    /**
+     * @brief Generates the table for the \p method IV layout and writes it to \p path
+     *
+     * @param path File to write
+     * @param method Method the IVs are generated with
+     *
+     * @return true if the table was written, false otherwise
+     */
+    bool build(const std::filesystem::path &path, Method method);
+
+    /**
+     * @brief Generates the block of the table that holds the states whose first IV call gives the \p hp, \p atk and \p def ivs
+     *
+     * @param hp HP iv
+     * @param atk Atk iv
+     * @param def Def iv
+     * @param block Array to write the 2^16 entries of the block
+     * @param method Method the IVs are generated with
+     */
+    void buildBlock(u8 hp, u8 atk, u8 def, u32 *block, Method method);
+
+    /**
+     * @brief Memory maps the table at \p path, replacing any table that was loaded for the same IV layout.
+     * This must not be called while a search is running.
+     *
+     * @param path File to map
+     *
+     * @return true if the file is a valid table, false otherwise
+     */
+    bool load(const std::filesystem::path &path);
+
+    /**
+     * @brief Recovers origin seeds for two 16 bit calls(15 bits known) for every Spe iv in a range from the loaded table
+     *
+     * @param hp HP iv
+     * @param atk Atk iv
+     * @param def Def iv
+     * @param spa SpA iv
+     * @param spd SpD iv
+     * @param minSpe Minimum Spe iv
+     * @param maxSpe Maximum Spe iv
+     * @param seeds Array to write results, needs room for 6 seeds per Spe iv
+     * @param offsets Array to write where the results of each Spe iv start, followed by the total number of results
+     * @param method Method the IVs were generated with
+     *
+     * @return Number of origin seeds, or -1 if no table is loaded for the \p method IV layout
+     */
+    int recover(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 minSpe, u8 maxSpe, u32 *seeds, int *offsets, Method method);
+
+    /**
+     * @brief Recovers origin seeds for two 16 bit calls(15 bits known) for every Spe iv in a range from a single block of the
+     * table, as generated by \ref buildBlock
+     *
+     * @param block Block of the \p hp, \p atk and \p def ivs
+     * @param hp HP iv
+     * @param atk Atk iv
+     * @param def Def iv
+     * @param spa SpA iv
+     * @param spd SpD iv
+     * @param minSpe Minimum Spe iv
+     * @param maxSpe Maximum Spe iv
+     * @param seeds Array to write results, needs room for 6 seeds per Spe iv
+     * @param offsets Array to write where the results of each Spe iv start, followed by the total number of results
+     *
+     * @return Number of origin seeds
+     */
+    int recover(const u32 *block, u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 minSpe, u8 maxSpe, u32 *seeds, int *offsets);
+
+    /**
+     * @brief Unmaps all loaded tables. This must not be called while a search is running.
+     */
+    void unload();
+}
+
+#endif // IVSEEDTABLE_HPP
@@ -19,6 +19,7 @@
 
 #include "LCRNGReverse.hpp"
 #include <Core/Enum/Method.hpp>
+#include <Core/RNG/IVSeedTable.hpp>
 #include <Core/RNG/LCRNG.hpp>
 
 /**
@@ -203,6 +204,24 @@ namespace LCRNGReverse
         return recoverPokeRNGIVMethod12(hp, atk, def, spa, spd, spe, seeds);
     }
 
+    int recoverPokeRNGIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 minSpe, u8 maxSpe, u32 *seeds, int *offsets, Method method)
+    {
+        int size = IVSeedTable::recover(hp, atk, def, spa, spd, minSpe, maxSpe, seeds, offsets, method);
+        if (size != -1)
+        {
+            return size;
+        }
+
+        size = 0;
+        for (u8 spe = minSpe; spe <= maxSpe; spe++)
+        {
+            offsets[spe - minSpe] = size;
+            size += recoverPokeRNGIV(hp, atk, def, spa, spd, spe, seeds + size, method);
+        }
+        offsets[maxSpe - minSpe + 1] = size;
+        return size;
+    }
+
     int recoverPokeRNGPID(u32 pid, u32 *seeds)
     {
         constexpr u32 add = 0x6073;
@@ -258,6 +277,18 @@ namespace LCRNGReverse
         return size;
     }
 
+    int recoverXDRNGIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 minSpe, u8 maxSpe, u32 *seeds, int *offsets)
+    {
+        int size = 0;
+        for (u8 spe = minSpe; spe <= maxSpe; spe++)
+        {
+            offsets[spe - minSpe] = size;
+            size += recoverXDRNGIV(hp, atk, def, spa, spd, spe, seeds + size);
+        }
+        offsets[maxSpe - minSpe + 1] = size;
+        return size;
+    }
+
     int recoverXDRNGPID(u32 pid, u32 *seeds)
     {
         int size = 0;
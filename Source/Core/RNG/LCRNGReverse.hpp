@@ -64,6 +64,25 @@ namespace LCRNGReverse
      */
     int recoverPokeRNGIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u32 *seeds, Method method);
 
+    /**
+     * @brief Recovers origin seeds for two 16 bit calls(15 bits known) with or without gap for every Spe iv in a range.
+     * This lets searchers handle a whole row of Spe ivs at a time. Uses the IVSeedTable when one is loaded for the \p method.
+     *
+     * @param hp HP iv
+     * @param atk Atk iv
+     * @param def Def iv
+     * @param spa SpA iv
+     * @param spd SpD iv
+     * @param minSpe Minimum Spe iv
+     * @param maxSpe Maximum Spe iv
+     * @param seeds Array to write results, needs room for 6 seeds per Spe iv
+     * @param offsets Array to write where the results of each Spe iv start, followed by the total number of results
+     * @param method Method the IVs were generated with
+     *
+     * @return Number of origin seeds
+     */
+    int recoverPokeRNGIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 minSpe, u8 maxSpe, u32 *seeds, int *offsets, Method method);
+
     /**
      * @brief Recovers origin seeds for two 16 bit calls
      *
@@ -89,6 +108,24 @@ namespace LCRNGReverse
      */
     int recoverXDRNGIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u32 *seeds);
 
+    /**
+     * @brief Recovers origin seeds for two 16 bit calls(15 bits known) for every Spe iv in a range.
+     * This lets searchers handle a whole row of Spe ivs at a time.
+     *
+     * @param hp HP iv
+     * @param atk Atk iv
+     * @param def Def iv
+     * @param spa SpA iv
+     * @param spd SpD iv
+     * @param minSpe Minimum Spe iv
+     * @param maxSpe Maximum Spe iv
+     * @param seeds Array to write results, needs room for 6 seeds per Spe iv
+     * @param offsets Array to write where the results of each Spe iv start, followed by the total number of results
+     *
+     * @return Number of origin seeds
+     */
+    int recoverXDRNGIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 minSpe, u8 maxSpe, u32 *seeds, int *offsets);
+
     /**
      * @brief Recovers origin seeds for two 16 bit calls
      *
@@ -18,6 +18,70 @@
  */
 
 #include "MT.hpp"
+#include <Core/RNG/MTKernels.hpp>
+#include <Core/Util/CPU.hpp>
+
+using ShuffleKernel = void (*)(u32 *state);
+
+static void shuffleBaseline(u32 *ptr)
+{
+    auto *state = reinterpret_cast<vuint128 *>(ptr);
+    vuint128 upperMask(0x80000000);
+    vuint128 lowerMask(0x7fffffff);
+    vuint128 matrix(0x9908b0df);
+    vuint128 one(1);
+
+    auto mm_recursion = [&upperMask, &lowerMask, &matrix, &one](vuint128 m0, vuint128 m1, vuint128 m2) {
+        vuint128 y = (m0 & upperMask) | (m1 & lowerMask);
+        vuint128 y1 = y >> 1;
+        vuint128 mag01 = ((y & one) == one) & matrix;
+        return y1 ^ mag01 ^ m2;
+    };
+
+    for (int i = 0; i < 224; i += 4)
+    {
+        vuint128 m0 = state[i / 4];
+        vuint128 m1 = v32x4_load(ptr + i + 1);
+        vuint128 m2 = v32x4_load(ptr + i + 397);
+        state[i / 4] = mm_recursion(m0, m1, m2);
+    }
+
+    // This technically reads out of bounds of the array
+    // This is okay however since it will read our MT index plus the additional padding
+    // The out of bounds read is immediately replaced with valid data from mt[0]
+    vuint128 last = v32x4_load(ptr + 621);
+    last[3] = ptr[0];
+    {
+        vuint128 m0 = state[56];
+        vuint128 m1 = v32x4_load(ptr + 225);
+        state[56] = mm_recursion(m0, m1, last);
+    }
+
+    for (int i = 228; i < 620; i += 4)
+    {
+        vuint128 m0 = state[i / 4];
+        vuint128 m1 = v32x4_load(ptr + i + 1);
+        vuint128 m2 = v32x4_load(ptr + i - 227);
+        state[i / 4] = mm_recursion(m0, m1, m2);
+    }
+
+    {
+        vuint128 m0 = state[155];
+        vuint128 m2 = v32x4_load(ptr + 393);
+        state[155] = mm_recursion(m0, last, m2);
+    }
+}
+
+static ShuffleKernel getShuffleKernel()
+{
+#ifdef SIMD_X86
+    static const ShuffleKernel kernel
+        = CPU::selectKernel<ShuffleKernel>({ shuffleBaseline, nullptr, MTKernels::shuffleAVX2, MTKernels::shuffleAVX512 });
+#else
+    static const ShuffleKernel kernel = shuffleBaseline;
+#endif
+    return kernel;
+}
 
 MT::MT(u32 seed) : index(624)
 {
@@ -72,49 +136,5 @@ u16 MT::nextUShort()
 
 void MT::shuffle()
 {
-    u32 *ptr = &state[0].uint32[0];
-    vuint128 upperMask(0x80000000);
-    vuint128 lowerMask(0x7fffffff);
-    vuint128 matrix(0x9908b0df);
-    vuint128 one(1);
-
-    auto mm_recursion = [&upperMask, &lowerMask, &matrix, &one](vuint128 m0, vuint128 m1, vuint128 m2) {
-        vuint128 y = (m0 & upperMask) | (m1 & lowerMask);
-        vuint128 y1 = y >> 1;
-        vuint128 mag01 = ((y & one) == one) & matrix;
-        return y1 ^ mag01 ^ m2;
-    };
-
-    for (int i = 0; i < 224; i += 4)
-    {
-        vuint128 m0 = state[i / 4];
-        vuint128 m1 = v32x4_load(ptr + i + 1);
-        vuint128 m2 = v32x4_load(ptr + i + 397);
-        state[i / 4] = mm_recursion(m0, m1, m2);
-    }
-
-    // This technically reads out of bounds of the array
-    // This is okay however since it will read our MT index plus the additional padding
-    // The out of bounds read is immediately replaced with valid data from mt[0]
-    vuint128 last = v32x4_load(ptr + 621);
-    last[3] = ptr[0];
-    {
-        vuint128 m0 = state[56];
-        vuint128 m1 = v32x4_load(ptr + 225);
-        state[56] = mm_recursion(m0, m1, last);
-    }
-
-    for (int i = 228; i < 620; i += 4)
-    {
-        vuint128 m0 = state[i / 4];
-        vuint128 m1 = v32x4_load(ptr + i + 1);
-        vuint128 m2 = v32x4_load(ptr + i - 227);
-        state[i / 4] = mm_recursion(m0, m1, m2);
-    }
-
-    {
-        vuint128 m0 = state[155];
-        vuint128 m2 = v32x4_load(ptr + 393);
-        state[155] = mm_recursion(m0, last, m2);
-    }
+    getShuffleKernel()(&state[0].uint32[0]);
 }
@@ -0,0 +1,92 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "MTKernels.hpp"
+
+// Matches the x86 detection in SIMD.hpp, which cannot be included here
+#if SIMD && (defined(__i386__) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_AMD64))
+#include <immintrin.h>
+
+static inline __m128i recursion(__m128i m0, __m128i m1, __m128i m2)
+{
+    __m128i y = _mm_or_si128(_mm_and_si128(m0, _mm_set1_epi32(0x80000000)), _mm_and_si128(m1, _mm_set1_epi32(0x7fffffff)));
+    __m128i mag01 = _mm_and_si128(_mm_srai_epi32(_mm_slli_epi32(y, 31), 31), _mm_set1_epi32(0x9908b0df));
+    return _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(y, 1), mag01), m2);
+}
+
+static inline __m256i recursion(__m256i m0, __m256i m1, __m256i m2)
+{
+    __m256i y = _mm256_or_si256(_mm256_and_si256(m0, _mm256_set1_epi32(0x80000000)), _mm256_and_si256(m1, _mm256_set1_epi32(0x7fffffff)));
+    __m256i mag01 = _mm256_and_si256(_mm256_srai_epi32(_mm256_slli_epi32(y, 31), 31), _mm256_set1_epi32(0x9908b0df));
+    return _mm256_xor_si256(_mm256_xor_si256(_mm256_srli_epi32(y, 1), mag01), m2);
+}
+
+static inline __m512i recursion(__m512i m0, __m512i m1, __m512i m2)
+{
+    // 0xca selects bits from m0 where the mask is set and from m1 otherwise, 0x96 is a three way xor
+    __m512i y = _mm512_ternarylogic_epi32(_mm512_set1_epi32(0x80000000), m0, m1, 0xca);
+    __m512i mag01 = _mm512_maskz_mov_epi32(_mm512_test_epi32_mask(y, _mm512_set1_epi32(1)), _mm512_set1_epi32(0x9908b0df));
+    return _mm512_ternarylogic_epi32(_mm512_srli_epi32(y, 1), mag01, m2, 0x96);
+}
+
+static inline __m512i load(const u32 *ptr)
+{
+    return _mm512_loadu_si512(ptr);
+}
+
+static inline __m256i load256(const u32 *ptr)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+}
+
+static inline __m128i load128(const u32 *ptr)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+}
+
+namespace MTKernels
+{
+    void shuffleAVX512(u32 *state)
+    {
+        for (int i = 0; i < 224; i += 16)
+        {
+            __m512i m0 = load(state + i);
+            __m512i m1 = load(state + i + 1);
+            __m512i m2 = load(state + i + 397);
+            _mm512_storeu_si512(state + i, recursion(m0, m1, m2));
+        }
+
+        // Same out of bounds read as the baseline shuffle, the word past the states is replaced by the new state[0]
+        __m128i last = _mm_insert_epi32(load128(state + 621), static_cast<int>(state[0]), 3);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 224), recursion(load128(state + 224), load128(state + 225), last));
+
+        for (int i = 228; i < 612; i += 16)
+        {
+            __m512i m0 = load(state + i);
+            __m512i m1 = load(state + i + 1);
+            __m512i m2 = load(state + i - 227);
+            _mm512_storeu_si512(state + i, recursion(m0, m1, m2));
+        }
+
+        __m256i tail = recursion(load256(state + 612), load256(state + 613), load256(state + 385));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(state + 612), tail);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 620), recursion(load128(state + 620), last, load128(state + 393)));
+    }
+}
+#endif
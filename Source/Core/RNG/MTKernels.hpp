@@ -0,0 +1,48 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef MTKERNELS_HPP
+#define MTKERNELS_HPP
+
+#include <Core/Global.hpp>
+
+/**
+ * Wider variants of the MT shuffle that MT selects at runtime through CPU::selectKernel.
+ * Each variant lives in its own translation unit built with the matching instruction set flags.
+ * Those translation units must not include headers with inline functions (such as SIMD.hpp),
+ * otherwise the linker could pick the wider copies for code that also runs on older CPUs.
+ */
+namespace MTKernels
+{
+    /**
+     * @brief Shuffles the 624 MT states using AVX2
+     *
+     * @param state MT states followed by at least one readable word
+     */
+    void shuffleAVX2(u32 *state);
+
+    /**
+     * @brief Shuffles the 624 MT states using AVX-512
+     *
+     * @param state MT states followed by at least one readable word
+     */
+    void shuffleAVX512(u32 *state);
+}
+
+#endif // MTKERNELS_HPP
@@ -51,6 +51,12 @@ void Xorshift::advance(u32 advances)
     }
 }
 
+std::array<u64, 2> Xorshift::getState() const
+{
+    const u64 *ptr = &state.uint64[0];
+    return { std::rotl(ptr[0], 32), std::rotl(ptr[1], 32) };
+}
+
 void Xorshift::jump(u32 advances)
 {
     advance(advances & 0x7f);
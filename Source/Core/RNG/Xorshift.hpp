@@ -22,6 +22,7 @@
 
 #include <Core/Global.hpp>
 #include <Core/RNG/SIMD.hpp>
+#include <array>
 
 /**
  * @brief Provides random numbers via the Xoroshift algorithm.
@@ -53,6 +54,13 @@ public:
      */
     void advance(u32 advances);
 
+    /**
+     * @brief Returns the current PRNG state in the same form the constructor accepts
+     *
+     * @return Array of seed0 and seed1
+     */
+    std::array<u64, 2> getState() const;
+
     /**
      * @brief Jumps the RNG by \p advances amount
      * Uses a precomputed jump table to complete in O(4096)
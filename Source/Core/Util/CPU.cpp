@@ -0,0 +1,107 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "CPU.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_AMD64))
+#define CPU_MSVC
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#define CPU_GNU
+#endif
+
+static CPULevel detectLevel()
+{
+#if defined(CPU_MSVC)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+
+    __cpuid(info, 1);
+    u32 ecx = info[2];
+    bool ssse3 = ecx & (1 << 9);
+    bool fma = ecx & (1 << 12);
+    bool sse41 = ecx & (1 << 19);
+    bool sse42 = ecx & (1 << 20);
+    bool popcnt = ecx & (1 << 23);
+    bool osxsave = ecx & (1 << 27);
+    bool avx = ecx & (1 << 28);
+    if (!(ssse3 && sse41 && sse42 && popcnt))
+    {
+        return CPULevel::Baseline;
+    }
+
+    // The OS has to save the YMM registers for AVX to be usable
+    if (maxLeaf < 7 || !osxsave || !avx)
+    {
+        return CPULevel::V2;
+    }
+    u64 xcr0 = _xgetbv(0);
+    if ((xcr0 & 0x6) != 0x6)
+    {
+        return CPULevel::V2;
+    }
+
+    __cpuidex(info, 7, 0);
+    u32 ebx = info[1];
+    bool avx2 = ebx & (1 << 5);
+    bool bmi2 = ebx & (1 << 8);
+    if (!(avx2 && bmi2 && fma))
+    {
+        return CPULevel::V2;
+    }
+
+    // The OS also has to save the opmask and ZMM registers for AVX-512
+    bool avx512 = (ebx & (1 << 16)) && (ebx & (1 << 17)) && (ebx & (1 << 30)) && (ebx & (1u << 31));
+    if (!avx512 || (xcr0 & 0xe6) != 0xe6)
+    {
+        return CPULevel::V3;
+    }
+    return CPULevel::V4;
+#elif defined(CPU_GNU)
+    // These checks include OS support for the extended register state
+    __builtin_cpu_init();
+    if (!(__builtin_cpu_supports("ssse3") && __builtin_cpu_supports("sse4.1") && __builtin_cpu_supports("sse4.2")
+          && __builtin_cpu_supports("popcnt")))
+    {
+        return CPULevel::Baseline;
+    }
+    if (!(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("fma")))
+    {
+        return CPULevel::V2;
+    }
+    if (!(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq")
+          && __builtin_cpu_supports("avx512vl")))
+    {
+        return CPULevel::V3;
+    }
+    return CPULevel::V4;
+#else
+    return CPULevel::Baseline;
+#endif
+}
+
+namespace CPU
+{
+    CPULevel getLevel()
+    {
+        static const CPULevel level = detectLevel();
+        return level;
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef CPU_HPP
+#define CPU_HPP
+
+#include <Core/Global.hpp>
+#include <array>
+
+/**
+ * @brief x86-64 microarchitecture levels that kernels can be compiled for
+ */
+enum class CPULevel : u8
+{
+    Baseline, // SSE2
+    V2, // SSSE3, SSE4.1, SSE4.2, POPCNT
+    V3, // AVX2, BMI2, FMA
+    V4 // AVX-512 F/BW/DQ/VL
+};
+
+namespace CPU
+{
+    /**
+     * @brief Detects the highest microarchitecture level supported by both the CPU and the OS.
+     * Non-x86 hosts always report CPULevel::Baseline.
+     *
+     * @return Supported level
+     */
+    CPULevel getLevel();
+
+    /**
+     * @brief Selects the kernel built for the highest level supported by the host.
+     * Missing entries fall back to the next lower level, so the baseline entry must always be set.
+     *
+     * @tparam Kernel Kernel function pointer type
+     * @param kernels Kernels indexed by CPULevel
+     *
+     * @return Selected kernel
+     */
+    template <class Kernel>
+    Kernel selectKernel(const std::array<Kernel, 4> &kernels)
+    {
+        for (int level = static_cast<int>(getLevel()); level > 0; level--)
+        {
+            if (kernels[level])
+            {
+                return kernels[level];
+            }
+        }
+        return kernels[0];
+    }
+}
+
+#endif // CPU_HPP
@@ -0,0 +1,334 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef RADIXSORT_HPP
+#define RADIXSORT_HPP
+
+#include <Core/Global.hpp>
+#include <algorithm>
+#include <array>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Provides a parallel LSD radix sort and deduplication for integer keys. Inputs below minimumSize and keys that are not
+ * integers fall back to the standard library sorts.
+ */
+namespace RadixSort
+{
+    /**
+     * @brief Inputs smaller than this are sorted on the calling thread
+     */
+    constexpr size_t minimumSize = 0x10000;
+
+    /**
+     * @brief Computes how many threads to use for \p size elements
+     *
+     * @param size Number of elements
+     * @param threads Requested number of threads, or 0 to use every core
+     *
+     * @return Number of threads
+     */
+    inline int getThreads(size_t size, int threads)
+    {
+        if (threads <= 0)
+        {
+            threads = static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u));
+        }
+        return static_cast<int>(std::clamp<size_t>(size / (minimumSize / 2), 1, threads));
+    }
+
+    /**
+     * @brief Computes the range of elements a thread works on
+     *
+     * @param size Number of elements
+     * @param threads Number of threads
+     * @param thread Thread index
+     *
+     * @return Start and end of the range
+     */
+    inline std::pair<size_t, size_t> getChunk(size_t size, int threads, int thread)
+    {
+        return { size * thread / threads, size * (thread + 1) / threads };
+    }
+
+    /**
+     * @brief Runs \p function once for every thread index and waits for all of them to finish
+     *
+     * @param threads Number of threads
+     * @param function Function taking the thread index
+     */
+    template <class Function>
+    void parallel(int threads, Function function)
+    {
+        std::vector<std::thread> threadContainer;
+        for (int i = 1; i < threads; i++)
+        {
+            threadContainer.emplace_back(function, i);
+        }
+
+        function(0);
+        for (auto &thread : threadContainer)
+        {
+            thread.join();
+        }
+    }
+
+    /**
+     * @brief Converts an integer key to an unsigned key with the same order
+     *
+     * @tparam Key Integer, bool, or enum type
+     * @param key Key to convert
+     *
+     * @return Unsigned key
+     */
+    template <class Key>
+    constexpr auto toUnsigned(Key key)
+    {
+        if constexpr (std::is_enum_v<Key>)
+        {
+            return toUnsigned(static_cast<std::underlying_type_t<Key>>(key));
+        }
+        else if constexpr (std::is_same_v<Key, bool>)
+        {
+            return static_cast<u8>(key);
+        }
+        else if constexpr (std::is_signed_v<Key>)
+        {
+            // Flipping the sign bit orders negative values before positive ones
+            using Unsigned = std::make_unsigned_t<Key>;
+            return static_cast<Unsigned>(static_cast<Unsigned>(key) ^ (Unsigned(1) << (sizeof(Unsigned) * 8 - 1)));
+        }
+        else
+        {
+            return key;
+        }
+    }
+
+    /**
+     * @brief Sorts \p data by an unsigned key one byte at a time. Each pass counts the digits of every thread's chunk and then
+     * scatters the chunks in parallel, which keeps the sort stable.
+     *
+     * @tparam Entry Default constructible element type
+     * @tparam Key Function returning the unsigned key of an element
+     * @param data Elements to sort
+     * @param key Key function
+     * @param threads Number of threads
+     */
+    template <class Entry, class Key>
+    void radix(std::vector<Entry> &data, Key key, int threads)
+    {
+        using Unsigned = decltype(key(data.front()));
+
+        size_t size = data.size();
+        std::vector<Entry> buffer(size);
+        std::vector<std::array<size_t, 256>> offsets(threads);
+
+        for (int shift = 0; shift < static_cast<int>(sizeof(Unsigned) * 8); shift += 8)
+        {
+            parallel(threads, [&](int thread) {
+                auto [begin, end] = getChunk(size, threads, thread);
+                auto &count = offsets[thread];
+                count.fill(0);
+                for (size_t i = begin; i < end; i++)
+                {
+                    count[(key(data[i]) >> shift) & 0xff]++;
+                }
+            });
+
+            // Turn the counts into where each thread writes each digit, passes where every key has the same digit are skipped
+            bool skip = false;
+            size_t offset = 0;
+            for (int digit = 0; digit < 256; digit++)
+            {
+                size_t total = 0;
+                for (int thread = 0; thread < threads; thread++)
+                {
+                    size_t count = offsets[thread][digit];
+                    offsets[thread][digit] = offset;
+                    offset += count;
+                    total += count;
+                }
+                skip |= total == size;
+            }
+
+            if (skip)
+            {
+                continue;
+            }
+
+            parallel(threads, [&](int thread) {
+                auto [begin, end] = getChunk(size, threads, thread);
+                auto &offset = offsets[thread];
+                for (size_t i = begin; i < end; i++)
+                {
+                    buffer[offset[(key(data[i]) >> shift) & 0xff]++] = data[i];
+                }
+            });
+            data.swap(buffer);
+        }
+    }
+
+    /**
+     * @brief Sorts unsigned integers in ascending order
+     *
+     * @tparam T Unsigned integer type
+     * @param data Integers to sort
+     * @param threads Number of threads, or 0 to use every core
+     */
+    template <class T>
+    void sort(std::vector<T> &data, int threads = 0)
+    {
+        static_assert(std::is_unsigned_v<T>, "RadixSort::sort requires unsigned integers");
+
+        if (data.size() < minimumSize)
+        {
+            std::sort(data.begin(), data.end());
+        }
+        else
+        {
+            radix(data, [](T value) { return value; }, getThreads(data.size(), threads));
+        }
+    }
+
+    /**
+     * @brief Stable sorts \p data by the key returned by \p key. Integer, bool, and enum keys are radix sorted together with
+     * the index of their element before the elements are moved into place, other keys use std::stable_sort.
+     *
+     * @tparam T Move constructible element type
+     * @tparam Key Function returning the key of an element
+     * @param data Elements to sort
+     * @param ascending Whether to sort in ascending or descending order
+     * @param key Key function
+     * @param threads Number of threads, or 0 to use every core
+     */
+    template <class T, class Key>
+    void sortBy(std::vector<T> &data, bool ascending, Key key, int threads = 0)
+    {
+        using KeyType = std::decay_t<std::invoke_result_t<Key &, const T &>>;
+
+        if constexpr (std::is_integral_v<KeyType> || std::is_enum_v<KeyType>)
+        {
+            using Unsigned = decltype(toUnsigned(std::declval<KeyType>()));
+            auto getKey = [&key, ascending](const T &value) {
+                Unsigned unsignedKey = toUnsigned(key(value));
+                return ascending ? unsignedKey : static_cast<Unsigned>(~unsignedKey);
+            };
+
+            size_t size = data.size();
+            if (size < minimumSize)
+            {
+                std::stable_sort(data.begin(), data.end(),
+                                 [&getKey](const T &left, const T &right) { return getKey(left) < getKey(right); });
+                return;
+            }
+
+            struct Entry
+            {
+                Unsigned key;
+                u32 index;
+            };
+
+            threads = getThreads(size, threads);
+            std::vector<Entry> entries(size);
+            parallel(threads, [&](int thread) {
+                auto [begin, end] = getChunk(size, threads, thread);
+                for (size_t i = begin; i < end; i++)
+                {
+                    entries[i] = { getKey(data[i]), static_cast<u32>(i) };
+                }
+            });
+            radix(entries, [](const Entry &entry) { return entry.key; }, threads);
+
+            std::vector<T> sorted;
+            sorted.reserve(size);
+            for (const auto &entry : entries)
+            {
+                sorted.emplace_back(std::move(data[entry.index]));
+            }
+            data.swap(sorted);
+        }
+        else
+        {
+            std::stable_sort(data.begin(), data.end(), [&key, ascending](const T &left, const T &right) {
+                return ascending ? key(left) < key(right) : key(right) < key(left);
+            });
+        }
+    }
+
+    /**
+     * @brief Sorts unsigned integers in ascending order and removes duplicates. Each thread removes the duplicates of its chunk
+     * of the sorted data, then the chunks are merged.
+     *
+     * @tparam T Unsigned integer type
+     * @param data Integers to sort
+     * @param threads Number of threads, or 0 to use every core
+     */
+    template <class T>
+    void sortUnique(std::vector<T> &data, int threads = 0)
+    {
+        sort(data, threads);
+
+        size_t size = data.size();
+        threads = getThreads(size, threads);
+        if (threads == 1)
+        {
+            data.erase(std::unique(data.begin(), data.end()), data.end());
+            return;
+        }
+
+        // Values before each chunk are saved first since the previous chunk is compacted at the same time
+        std::vector<T> previous(threads);
+        for (int thread = 1; thread < threads; thread++)
+        {
+            previous[thread] = data[getChunk(size, threads, thread).first - 1];
+        }
+
+        std::vector<std::pair<size_t, size_t>> ranges(threads);
+        parallel(threads, [&](int thread) {
+            auto [begin, end] = getChunk(size, threads, thread);
+            if (thread != 0)
+            {
+                while (begin != end && data[begin] == previous[thread])
+                {
+                    begin++;
+                }
+            }
+
+            auto last = std::unique(data.begin() + begin, data.begin() + end);
+            ranges[thread] = { begin, static_cast<size_t>(last - data.begin()) };
+        });
+
+        size_t write = ranges[0].second;
+        for (int thread = 1; thread < threads; thread++)
+        {
+            auto [begin, end] = ranges[thread];
+            if (write != begin)
+            {
+                std::move(data.begin() + begin, data.begin() + end, data.begin() + write);
+            }
+            write += end - begin;
+        }
+        data.resize(write);
+    }
+}
+
+#endif // RADIXSORT_HPP
@@ -25,7 +25,7 @@
 #include <algorithm>
 #include <bit>
 #include <iterator>
-#include <map>
+#include <memory>
 
 enum class Language
 {
@@ -65,25 +65,37 @@ enum class Translation
 };
 
 static Language language;
-static std::vector<std::string> abilities;
-static std::vector<std::string> characteristics;
-static std::map<u16, std::string> forms;
-static std::vector<std::string> games;
-static std::vector<std::string> hiddenPowers;
-static std::vector<std::string> items;
-static std::vector<std::string> moves;
-static std::vector<std::string> natures;
-static std::vector<std::string> species;
 const static std::array<std::string, 3> genders = { "♂", "♀", "-" };
 const static std::array<std::string, 12> buttons = { "R", "L", "X", "Y", "A", "B", "Select", "Start", "Right", "Left", "Up", "Down" };
 
 /**
- * @brief Reads strings from the \p translation in the languaged specified by Translator::init()
+ * @brief Translated string that is identified by a number rather than its position
+ */
+struct MappedString
+{
+    /**
+     * @brief Construct a new MappedString object
+     *
+     * @param num String number
+     * @param string Translated string
+     */
+    MappedString(u16 num, const std::string &string) : num(num), string(string)
+    {
+    }
+
+    u16 num;
+    std::string string;
+};
+
+/**
+ * @brief Decompresses the \p translation in the languaged specified by Translator::init()
  *
  * @param translation String category to read from
- * @param strings Vector to write strings out to
+ * @param length Length of the decompressed data
+ *
+ * @return Decompressed null separated strings
  */
-static void readFile(Translation translation, std::vector<std::string> &strings)
+static std::unique_ptr<char[]> decompress(Translation translation, u32 &length)
 {
     int index = (static_cast<int>(language) * static_cast<int>(Translation::Count)) + static_cast<int>(translation);
     u32 start = INDICES[index];
@@ -92,18 +104,32 @@ static void readFile(Translation translation, std::vector<std::string> &strings)
     const char *compressedData = reinterpret_cast<const char *>(I18N + start);
     u32 compressedLength = end - start;
 
+    return std::unique_ptr<char[]>(Utilities::decompress(compressedData, compressedLength, length));
+}
+
+/**
+ * @brief Reads strings from the \p translation in the languaged specified by Translator::init()
+ *
+ * @param translation String category to read from
+ *
+ * @return Vector of translated strings
+ */
+static std::vector<std::string> readFile(Translation translation)
+{
     u32 length;
-    char *data = Utilities::decompress(compressedData, compressedLength, length);
+    auto data = decompress(translation, length);
 
+    std::vector<std::string> strings;
+    strings.reserve(std::count(data.get(), data.get() + length, 0));
     for (u32 i = 0; i < length;)
     {
-        char *it = std::find(data + i, data + length, 0);
+        char *it = std::find(data.get() + i, data.get() + length, 0);
         u32 len = it - &data[i];
-        strings.emplace_back(data + i, len);
+        strings.emplace_back(&data[i], len);
         i += len + 1;
     }
 
-    delete[] data;
+    return strings;
 }
 
 /**
@@ -111,63 +137,100 @@ static void readFile(Translation translation, std::vector<std::string> &strings)
  *
  * @param translation String category to read from
  *
- * @return Map of translated strings
+ * @return Translated strings sorted by their number
  */
-static std::map<u16, std::string> readFile(Translation translation)
+static std::vector<MappedString> readMappedFile(Translation translation)
 {
-    int index = (static_cast<int>(language) * static_cast<int>(Translation::Count)) + static_cast<int>(translation);
-    u32 start = INDICES[index];
-    u32 end = INDICES[index + 1];
-
-    const char *compressedData = reinterpret_cast<const char *>(I18N + start);
-    u32 compressedLength = end - start;
-
     u32 length;
-    char *data = Utilities::decompress(compressedData, compressedLength, length);
+    auto data = decompress(translation, length);
 
-    std::map<u16, std::string> strings;
+    std::vector<MappedString> strings;
+    strings.reserve(std::count(data.get(), data.get() + length, 0));
     for (u32 i = 0; i < length;)
     {
-        char *it = std::find(data + i, data + length, 0);
+        char *it = std::find(data.get() + i, data.get() + length, 0);
         u32 len = it - &data[i];
 
         char *word;
         u16 num = std::strtoul(&data[i], &word, 10);
-        strings[num] = std::string(word + 1, it - word - 1);
+        strings.emplace_back(num, std::string(word + 1, it - word - 1));
 
         i += len + 1;
     }
 
-    delete[] data;
+    std::stable_sort(strings.begin(), strings.end(),
+                     [](const MappedString &left, const MappedString &right) { return left.num < right.num; });
+    return strings;
+}
+
+/**
+ * @brief Finds the string with the matching \p num
+ *
+ * @param strings Translated strings sorted by their number
+ * @param num String number
+ *
+ * @return Pointer to the string if found, otherwise nullptr
+ */
+static const std::string *findMappedString(const std::vector<MappedString> &strings, u16 num)
+{
+    auto it = std::lower_bound(strings.begin(), strings.end(), num, [](const MappedString &string, u16 num) { return string.num < num; });
+    return it != strings.end() && it->num == num ? &it->string : nullptr;
+}
+
+/**
+ * @brief Gets the strings of the \p translation, reading them the first time they are requested
+ *
+ * @tparam translation String category to read from
+ *
+ * @return Vector of translated strings
+ */
+template <Translation translation>
+static const std::vector<std::string> &getStrings()
+{
+    static const std::vector<std::string> strings = readFile(translation);
     return strings;
 }
 
+/**
+ * @brief Gets the form strings, reading them the first time they are requested
+ *
+ * @return Form strings sorted by their number
+ */
+static const std::vector<MappedString> &getForms()
+{
+    static const std::vector<MappedString> forms = readMappedFile(Translation::Form);
+    return forms;
+}
+
 namespace Translator
 {
     const std::string &getAbility(u16 ability)
     {
-        return abilities[ability - 1];
+        return getStrings<Translation::Ability>()[ability - 1];
     }
 
     const std::string &getCharacteristic(u8 characteristic)
     {
-        return characteristics[characteristic];
+        return getStrings<Translation::Characteristic>()[characteristic];
     }
 
     const std::vector<std::string> &getCharacteristics()
     {
-        return characteristics;
+        return getStrings<Translation::Characteristic>();
     }
 
     const std::string &getForm(u16 specie, u8 form)
     {
-        return forms[(form << 11) | specie];
+        static const std::string empty;
+        const std::string *string = findMappedString(getForms(), (form << 11) | specie);
+        return string ? *string : empty;
     }
 
     const std::string &getGame(Game version)
     {
         // Strings are ordered to match the enum
         // Use countr_zero to get the bit that is set
+        const auto &games = getStrings<Translation::Game>();
         int index = std::countr_zero(toInt(version));
         if (index == 32)
         {
@@ -188,24 +251,25 @@ namespace Translator
 
     const std::string &getHiddenPower(u8 power)
     {
-        return hiddenPowers[power];
+        return getStrings<Translation::Power>()[power];
     }
 
     const std::vector<std::string> &getHiddenPowers()
     {
-        return hiddenPowers;
+        return getStrings<Translation::Power>();
     }
 
     const std::string &getItem(u16 item)
     {
-        return items[item];
+        return getStrings<Translation::Item>()[item];
     }
 
     std::vector<std::string> getItems(const std::vector<u16> &item)
     {
         std::vector<std::string> s;
         s.reserve(item.size());
-        std::transform(item.begin(), item.end(), std::back_inserter(s), [](u16 num) { return items[num]; });
+        std::transform(item.begin(), item.end(), std::back_inserter(s),
+                       [&items = getStrings<Translation::Item>()](u16 num) { return items[num]; });
         return s;
     }
 
@@ -282,39 +346,43 @@ namespace Translator
             translation = Translation::BDSP;
         }
 
-        std::map<u16, std::string> map = readFile(translation);
+        std::vector<MappedString> strings = readMappedFile(translation);
         std::vector<std::string> locations;
         locations.reserve(nums.size());
-        std::transform(nums.begin(), nums.end(), std::back_inserter(locations), [&map](u16 num) { return map[num]; });
+        std::transform(nums.begin(), nums.end(), std::back_inserter(locations), [&strings](u16 num) {
+            const std::string *string = findMappedString(strings, num);
+            return string ? *string : std::string();
+        });
         return locations;
     }
 
     const std::string &getMove(u16 move)
     {
-        return moves[move];
+        return getStrings<Translation::Move>()[move];
     }
 
     const std::string &getNature(u8 nature)
     {
-        return natures[nature];
+        return getStrings<Translation::Nature>()[nature];
     }
 
     const std::vector<std::string> &getNatures()
     {
-        return natures;
+        return getStrings<Translation::Nature>();
     }
 
     const std::string &getSpecie(u16 specie)
     {
-        return species[specie - 1];
+        return getStrings<Translation::Specie>()[specie - 1];
     }
 
     std::string getSpecie(u16 specie, u8 form)
     {
-        auto it = forms.find((form << 11) | specie);
-        if (it != forms.end())
+        const auto &species = getStrings<Translation::Specie>();
+        const std::string *string = findMappedString(getForms(), (form << 11) | specie);
+        if (string)
         {
-            return species[specie - 1] + " (" + it->second + ")";
+            return species[specie - 1] + " (" + *string + ")";
         }
         else
         {
@@ -364,15 +432,5 @@ namespace Translator
         {
             language = Language::Chinese;
         }
-
-        readFile(Translation::Ability, abilities);
-        readFile(Translation::Characteristic, characteristics);
-        forms = readFile(Translation::Form);
-        readFile(Translation::Game, games);
-        readFile(Translation::Power, hiddenPowers);
-        readFile(Translation::Item, items);
-        readFile(Translation::Move, moves);
-        readFile(Translation::Nature, natures);
-        readFile(Translation::Specie, species);
     }
 }
@@ -210,7 +210,8 @@ namespace Translator
 
     /**
      * @brief Initalize the Translator with what \p locale to use.
-     * This must be called before using any other function in the namespace.
+     * This must be called before using any other function in the namespace. Each string category is read the first time it
+     * is used.
      *
      * @param locale Language
      */
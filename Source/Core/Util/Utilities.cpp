@@ -23,6 +23,7 @@
 #include <Core/RNG/LCRNG.hpp>
 #include <Core/RNG/MT.hpp>
 #include <Core/Util/DateTime.hpp>
+#include <algorithm>
 #include <bzlib.h>
 
 static u32 advanceProbabilityTable(BWRNG &rng)
@@ -68,6 +69,166 @@ static u32 advanceProbabilityTable(BWRNG &rng)
     return count;
 }
 
+/**
+ * @brief Advances each lane whose \p mask is set
+ *
+ * @tparam lanes Number of seeds processed at once
+ * @param seeds PRNG states
+ * @param counts Advance counts
+ * @param mask Lanes to advance
+ */
+template <int lanes>
+static void advanceLanes(u64 *seeds, u32 *counts, const bool *mask)
+{
+    for (int i = 0; i < lanes; i++)
+    {
+        u64 next = seeds[i] * BWRNG::getMult() + BWRNG::getAdd();
+        seeds[i] = mask[i] ? next : seeds[i];
+        counts[i] += mask[i];
+    }
+}
+
+/**
+ * @brief Rolls a percentage for each lane whose \p mask is set and clears the mask of lanes that did not pass \p threshold
+ *
+ * @tparam lanes Number of seeds processed at once
+ * @param seeds PRNG states
+ * @param counts Advance counts
+ * @param mask Lanes to roll
+ * @param threshold Value the roll has to exceed
+ */
+template <int lanes>
+static void rollLanes(u64 *seeds, u32 *counts, bool *mask, u32 threshold)
+{
+    for (int i = 0; i < lanes; i++)
+    {
+        u64 next = seeds[i] * BWRNG::getMult() + BWRNG::getAdd();
+        u32 roll = ((next >> 32) * 101) >> 32;
+        seeds[i] = mask[i] ? next : seeds[i];
+        counts[i] += mask[i];
+        mask[i] = mask[i] && roll > threshold;
+    }
+}
+
+/**
+ * @brief Branchless version of \ref advanceProbabilityTable that resolves every round for multiple seeds at once
+ *
+ * @tparam lanes Number of seeds processed at once
+ * @param seeds PRNG states
+ * @param counts Advance counts
+ */
+template <int lanes>
+static void advanceProbabilityTable(u64 *seeds, u32 *counts)
+{
+    bool mask[lanes];
+
+    // Round 1
+    std::fill_n(mask, lanes, true);
+    advanceLanes<lanes>(seeds, counts, mask);
+
+    // Round 2
+    rollLanes<lanes>(seeds, counts, mask, 50);
+    advanceLanes<lanes>(seeds, counts, mask);
+
+    // Round 3
+    std::fill_n(mask, lanes, true);
+    rollLanes<lanes>(seeds, counts, mask, 30);
+    advanceLanes<lanes>(seeds, counts, mask);
+
+    // Round 4
+    std::fill_n(mask, lanes, true);
+    rollLanes<lanes>(seeds, counts, mask, 25);
+    rollLanes<lanes>(seeds, counts, mask, 30);
+    advanceLanes<lanes>(seeds, counts, mask);
+
+    // Round 5
+    std::fill_n(mask, lanes, true);
+    rollLanes<lanes>(seeds, counts, mask, 20);
+    rollLanes<lanes>(seeds, counts, mask, 25);
+    rollLanes<lanes>(seeds, counts, mask, 33);
+    advanceLanes<lanes>(seeds, counts, mask);
+}
+
+/**
+ * @brief Calculates the initial set of advances for BW for multiple seeds at once
+ *
+ * @tparam lanes Number of seeds processed at once
+ * @param seeds PRNG states
+ * @param advances Initial advance counts
+ */
+template <int lanes>
+static void initialAdvancesBWLanes(const u64 *seeds, u32 *advances)
+{
+    u64 rng[lanes];
+    std::copy_n(seeds, lanes, rng);
+    std::fill_n(advances, lanes, 0);
+
+    for (u8 i = 0; i < 5; i++)
+    {
+        advanceProbabilityTable<lanes>(rng, advances);
+    }
+}
+
+/**
+ * @brief Calculates the initial set of advances for BW2 for multiple seeds at once
+ *
+ * @tparam lanes Number of seeds processed at once
+ * @param seeds PRNG states
+ * @param advances Initial advance counts
+ * @param memory Whether memory link is activated or not
+ */
+template <int lanes>
+static void initialAdvancesBW2Lanes(const u64 *seeds, u32 *advances, bool memory)
+{
+    u64 rng[lanes];
+    std::copy_n(seeds, lanes, rng);
+    std::fill_n(advances, lanes, 0);
+
+    for (u8 i = 0; i < 5; i++)
+    {
+        advanceProbabilityTable<lanes>(rng, advances);
+
+        if (i == 0)
+        {
+            for (int j = 0; j < lanes; j++)
+            {
+                BWRNG go(rng[j]);
+                rng[j] = go.advance(memory ? 2 : 3);
+                advances[j] += memory ? 2 : 3;
+            }
+        }
+    }
+
+    bool active[lanes];
+    std::fill_n(active, lanes, true);
+    for (u8 limit = 0; limit < 100; limit++)
+    {
+        bool any = false;
+        for (int j = 0; j < lanes; j++)
+        {
+            u64 seed1 = rng[j] * BWRNG::getMult() + BWRNG::getAdd();
+            u64 seed2 = seed1 * BWRNG::getMult() + BWRNG::getAdd();
+            u64 seed3 = seed2 * BWRNG::getMult() + BWRNG::getAdd();
+
+            u8 rand1 = ((seed1 >> 32) * 15) >> 32;
+            u8 rand2 = ((seed2 >> 32) * 15) >> 32;
+            u8 rand3 = ((seed3 >> 32) * 15) >> 32;
+
+            rng[j] = active[j] ? seed3 : rng[j];
+            advances[j] += active[j] ? 3 : 0;
+
+            // Lanes where none of the 3 rand calls are duplicates are done
+            active[j] = active[j] && (rand1 == rand2 || rand1 == rand3 || rand2 == rand3);
+            any |= active[j];
+        }
+
+        if (!any)
+        {
+            break;
+        }
+    }
+}
+
 static std::string getPitch(u8 result)
 {
     std::string pitch;
@@ -255,6 +416,18 @@ namespace Utilities5
         }
     }
 
+    void initialAdvances(const u64 *seeds, u32 *advances, u32 count, const Profile5 &profile)
+    {
+        if ((profile.getVersion() & Game::BW) != Game::None)
+        {
+            initialAdvancesBW(seeds, advances, count);
+        }
+        else
+        {
+            initialAdvancesBW2(seeds, advances, count, profile.getMemoryLink());
+        }
+    }
+
     u32 initialAdvancesBW(u64 seed)
     {
         BWRNG rng(seed);
@@ -268,6 +441,20 @@ namespace Utilities5
         return count;
     }
 
+    void initialAdvancesBW(const u64 *seeds, u32 *advances, u32 count)
+    {
+        u32 i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            initialAdvancesBWLanes<8>(seeds + i, advances + i);
+        }
+
+        for (; i < count; i++)
+        {
+            advances[i] = initialAdvancesBW(seeds[i]);
+        }
+    }
+
     u32 initialAdvancesBW2(u64 seed, bool memory)
     {
         BWRNG rng(seed);
@@ -302,6 +489,20 @@ namespace Utilities5
         return count;
     }
 
+    void initialAdvancesBW2(const u64 *seeds, u32 *advances, u32 count, bool memory)
+    {
+        u32 i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            initialAdvancesBW2Lanes<8>(seeds + i, advances + i, memory);
+        }
+
+        for (; i < count; i++)
+        {
+            advances[i] = initialAdvancesBW2(seeds[i], memory);
+        }
+    }
+
     u32 initialAdvancesBWID(u64 seed)
     {
         BWRNG rng(seed);
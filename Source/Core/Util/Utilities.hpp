@@ -216,6 +216,17 @@ namespace Utilities5
      */
     u32 initialAdvances(u64 seed, const Profile5 &profile);
 
+    /**
+     * @brief Calculates the initial set of advances for the \p profile for a block of seeds.
+     * Seeds are resolved 8 at a time with every branch of the probability table evaluated as a lane mask.
+     *
+     * @param seeds PRNG states
+     * @param advances Output initial advance counts
+     * @param count Number of seeds
+     * @param profile Profile information
+     */
+    void initialAdvances(const u64 *seeds, u32 *advances, u32 count, const Profile5 &profile);
+
     /**
      * @brief Calculates the initial set of advances for BW
      *
@@ -225,6 +236,15 @@ namespace Utilities5
      */
     u32 initialAdvancesBW(u64 seed);
 
+    /**
+     * @brief Calculates the initial set of advances for BW for a block of seeds
+     *
+     * @param seeds PRNG states
+     * @param advances Output initial advance counts
+     * @param count Number of seeds
+     */
+    void initialAdvancesBW(const u64 *seeds, u32 *advances, u32 count);
+
     /**
      * @brief Calculates the initial set of advances for BW2
      *
@@ -235,6 +255,16 @@ namespace Utilities5
      */
     u32 initialAdvancesBW2(u64 seed, bool memory);
 
+    /**
+     * @brief Calculates the initial set of advances for BW2 for a block of seeds
+     *
+     * @param seeds PRNG states
+     * @param advances Output initial advance counts
+     * @param count Number of seeds
+     * @param memory Whether memory link is activated or not
+     */
+    void initialAdvancesBW2(const u64 *seeds, u32 *advances, u32 count, bool memory);
+
     /**
      * @brief Calculates the initial set of advances for BW ID
      *
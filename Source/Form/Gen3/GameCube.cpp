@@ -32,10 +32,12 @@
 #include <Core/Util/Translator.hpp>
 #include <Form/Controls/Controls.hpp>
 #include <Form/Gen3/Profile/ProfileManager3.hpp>
+#include <Form/Util/SearchDiagnostics.hpp>
 #include <Model/Gen3/GameCubeModel.hpp>
 #include <QSettings>
 #include <QThread>
 #include <QTimer>
+#include <limits>
 
 GameCube::GameCube(QWidget *parent) : QWidget(parent), ui(new Ui::GameCube)
 {
@@ -239,7 +241,7 @@ void GameCube::search()
     auto filter = ui->filterSearcher->getFilter<StateFilter>();
     auto *searcher = new GameCubeSearcher(method, ui->checkBoxSearcherFirstShadowUnset->isChecked(), *currentProfile, filter);
 
-    int maxProgress = 1;
+    u64 maxProgress = 1;
     if (method != Method::Channel)
     {
         for (u8 i = 0; i < 6; i++)
@@ -250,9 +252,16 @@ void GameCube::search()
     else
     {
         maxProgress *= max[4] - min[4] + 1;
-        maxProgress *= 0x7ffffff;
+        maxProgress *= 0x8000000;
     }
-    ui->progressBar->setRange(0, maxProgress);
+
+    // Channel searches can go past the range of the progress bar so they are shown at a coarser scale
+    int shift = 0;
+    while ((maxProgress >> shift) > std::numeric_limits<int>::max())
+    {
+        shift++;
+    }
+    ui->progressBar->setRange(0, static_cast<int>(maxProgress >> shift));
 
     QThread *thread;
     if (shadowLock)
@@ -271,9 +280,10 @@ void GameCube::search()
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
     auto *timer = new QTimer();
+    SearchDiagnostics::attach(searcher, timer, thread);
     timer->callOnTimeout(this, [=] {
         searcherModel->addItems(searcher->getResults());
-        ui->progressBar->setValue(searcher->getProgress());
+        ui->progressBar->setValue(static_cast<int>(searcher->getTotalProgress() >> shift));
     });
     connect(thread, &QThread::finished, timer, &QTimer::stop);
     connect(thread, &QThread::finished, timer, &QTimer::deleteLater);
@@ -281,7 +291,7 @@ void GameCube::search()
         ui->pushButtonSearch->setEnabled(true);
         ui->pushButtonCancel->setEnabled(false);
         searcherModel->addItems(searcher->getResults());
-        ui->progressBar->setValue(searcher->getProgress());
+        ui->progressBar->setValue(static_cast<int>(searcher->getTotalProgress() >> shift));
         delete searcher;
     });
 
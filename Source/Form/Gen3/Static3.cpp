@@ -31,6 +31,7 @@
 #include <Form/Controls/Controls.hpp>
 #include <Form/Gen3/Profile/ProfileManager3.hpp>
 #include <Form/Gen3/Tools/SeedToTime3.hpp>
+#include <Form/Util/SearchDiagnostics.hpp>
 #include <Model/Gen3/StaticModel3.hpp>
 #include <QAction>
 #include <QSettings>
@@ -234,6 +235,7 @@ void Static3::search()
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
     auto *timer = new QTimer();
+    SearchDiagnostics::attach(searcher, timer, thread);
     timer->callOnTimeout(this, [=] {
         searcherModel->addItems(searcher->getResults());
         ui->progressBar->setValue(searcher->getProgress());
@@ -23,6 +23,7 @@
 #include <Core/Gen3/Searchers/ColoSeedSearcher.hpp>
 #include <Core/Gen3/Searchers/GalesSeedSearcher.hpp>
 #include <Core/Util/Translator.hpp>
+#include <Form/Util/SearchDiagnostics.hpp>
 #include <QClipboard>
 #include <QFileDialog>
 #include <QMessageBox>
@@ -217,6 +218,7 @@ void GameCubeSeedFinder::channelSearch()
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
 
     auto *timer = new QTimer();
+    SearchDiagnostics::attach(searcher, timer, thread);
     timer->callOnTimeout(this, [=] { updateChannelProgress(searcher->getProgress()); });
     connect(thread, &QThread::finished, timer, &QTimer::stop);
     connect(thread, &QThread::finished, timer, &QTimer::deleteLater);
@@ -336,6 +338,7 @@ void GameCubeSeedFinder::coloSearch()
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
 
     auto *timer = new QTimer();
+    SearchDiagnostics::attach(searcher, timer, thread);
     timer->callOnTimeout(this, [=] { updateColoProgress(searcher->getProgress()); });
     connect(thread, &QThread::finished, timer, &QTimer::stop);
     connect(thread, &QThread::finished, timer, &QTimer::deleteLater);
@@ -460,6 +463,7 @@ void GameCubeSeedFinder::galesSearch()
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
 
     auto *timer = new QTimer();
+    SearchDiagnostics::attach(searcher, timer, thread);
     timer->callOnTimeout(this, [=] { updateGalesProgress(searcher->getProgress()); });
     connect(thread, &QThread::finished, timer, &QTimer::stop);
     connect(thread, &QThread::finished, timer, &QTimer::deleteLater);
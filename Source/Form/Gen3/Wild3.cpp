@@ -33,6 +33,7 @@
 #include <Form/Controls/Controls.hpp>
 #include <Form/Gen3/Profile/ProfileManager3.hpp>
 #include <Form/Gen3/Tools/SeedToTime3.hpp>
+#include <Form/Util/SearchDiagnostics.hpp>
 #include <Model/Gen3/WildModel3.hpp>
 #include <QAction>
 #include <QSettings>
@@ -101,6 +102,7 @@ Wild3::Wild3(QWidget *parent) : QWidget(parent), ui(new Ui::Wild3)
     connect(ui->comboBoxSearcherPokemon, &QComboBox::currentIndexChanged, this, &Wild3::searcherPokemonIndexChanged);
     connect(ui->checkBoxGeneratorFeebasTile, &QCheckBox::stateChanged, this, &Wild3::generatorFeebasTileStateChanged);
     connect(ui->checkBoxSearcherFeebasTile, &QCheckBox::stateChanged, this, &Wild3::searcherFeebasTileStateChanged);
+    connect(ui->checkBoxSearcherAllLeads, &QCheckBox::toggled, ui->comboMenuSearcherLead, &ComboMenu::setDisabled);
     connect(ui->pushButtonProfileManager, &QPushButton::clicked, this, &Wild3::profileManager);
     connect(ui->filterGenerator, &Filter::showStatsChanged, generatorModel, &WildGeneratorModel3::setShowStats);
     connect(ui->filterSearcher, &Filter::showStatsChanged, searcherModel, &WildSearcherModel3::setShowStats);
@@ -324,6 +326,7 @@ void Wild3::profileIndexChanged(int index)
 
             ui->labelSearcherLead->setVisible(true);
             ui->comboMenuSearcherLead->setVisible(true);
+            ui->checkBoxSearcherAllLeads->setVisible(true);
         }
         else
         {
@@ -334,6 +337,8 @@ void Wild3::profileIndexChanged(int index)
             ui->comboMenuSearcherLead->clearSelection();
             ui->labelSearcherLead->setVisible(false);
             ui->comboMenuSearcherLead->setVisible(false);
+            ui->checkBoxSearcherAllLeads->setChecked(false);
+            ui->checkBoxSearcherAllLeads->setVisible(false);
         }
 
         generatorEncounterIndexChanged(0);
@@ -358,11 +363,30 @@ void Wild3::search()
     std::array<u8, 6> min = ui->filterSearcher->getMinIVs();
     std::array<u8, 6> max = ui->filterSearcher->getMaxIVs();
     auto method = ui->comboBoxSearcherMethod->getEnum<Method>();
-    auto lead = ui->comboMenuSearcherLead->getEnum<Lead>();
     bool feebas = ui->checkBoxSearcherFeebasTile->isChecked();
 
+    std::vector<Lead> leads;
+    if (ui->checkBoxSearcherAllLeads->isChecked())
+    {
+        // Searching the leads together only walks each seed back once
+        auto encounter = ui->comboBoxSearcherEncounter->getEnum<Encounter>();
+        leads = { Lead::None, Lead::Synchronize, Lead::CuteCharmM, Lead::CuteCharmF, Lead::Pressure };
+        if (encounter == Encounter::Grass)
+        {
+            leads.emplace_back(Lead::MagnetPull);
+        }
+        if (encounter == Encounter::Grass || encounter == Encounter::Surfing)
+        {
+            leads.emplace_back(Lead::Static);
+        }
+    }
+    else
+    {
+        leads.emplace_back(ui->comboMenuSearcherLead->getEnum<Lead>());
+    }
+
     auto filter = ui->filterSearcher->getFilter<WildStateFilter, true>();
-    auto *searcher = new WildSearcher3(method, lead, feebas, encounterSearcher[ui->comboBoxSearcherLocation->getCurrentInt()],
+    auto *searcher = new WildSearcher3(method, leads, feebas, encounterSearcher[ui->comboBoxSearcherLocation->getCurrentInt()],
                                        *currentProfile, filter);
 
     int maxProgress = 1;
@@ -377,6 +401,7 @@ void Wild3::search()
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
     auto *timer = new QTimer();
+    SearchDiagnostics::attach(searcher, timer, thread);
     timer->callOnTimeout(this, [=] {
         searcherModel->addItems(searcher->getResults());
         ui->progressBar->setValue(searcher->getProgress());
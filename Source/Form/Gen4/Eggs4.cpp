@@ -28,6 +28,7 @@
 #include <Form/Controls/Controls.hpp>
 #include <Form/Gen4/Profile/ProfileManager4.hpp>
 #include <Form/Gen4/Tools/SeedToTime4.hpp>
+#include <Form/Util/SearchDiagnostics.hpp>
 #include <Model/Gen4/EggModel4.hpp>
 #include <QAction>
 #include <QMessageBox>
@@ -237,6 +238,7 @@ void Eggs4::search()
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
     auto *timer = new QTimer();
+    SearchDiagnostics::attach(searcher, timer, thread);
     connect(timer, &QTimer::timeout, this, [=] {
         searcherModel->addItems(searcher->getResults());
         ui->progressBar->setValue(searcher->getProgress());
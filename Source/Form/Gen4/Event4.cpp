@@ -30,6 +30,7 @@
 #include <Form/Controls/Controls.hpp>
 #include <Form/Gen4/Profile/ProfileManager4.hpp>
 #include <Form/Gen4/Tools/SeedToTime4.hpp>
+#include <Form/Util/SearchDiagnostics.hpp>
 #include <Model/Gen4/EventModel4.hpp>
 #include <QAction>
 #include <QSettings>
@@ -216,6 +217,7 @@ void Event4::search()
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
     auto *timer = new QTimer();
+    SearchDiagnostics::attach(searcher, timer, thread);
     timer->callOnTimeout(this, [=] {
         searcherModel->addItems(searcher->getResults());
         ui->progressBar->setValue(searcher->getProgress());
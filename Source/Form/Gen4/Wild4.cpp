@@ -34,6 +34,7 @@
 #include <Form/Controls/Controls.hpp>
 #include <Form/Gen4/Profile/ProfileManager4.hpp>
 #include <Form/Gen4/Tools/SeedToTime4.hpp>
+#include <Form/Util/SearchDiagnostics.hpp>
 #include <Model/Gen4/WildModel4.hpp>
 #include <QMessageBox>
 #include <QSettings>
@@ -258,7 +259,7 @@ void Wild4::updateProfiles()
     }
 }
 
-void Wild4::updateEncounterGenerator()
+void Wild4::updateEncounterGenerator(bool location)
 {
     auto encounter = ui->comboBoxGeneratorEncounter->getEnum<Encounter>();
 
@@ -285,10 +286,23 @@ void Wild4::updateEncounterGenerator()
     settings.time = ui->comboBoxGeneratorTime->currentIndex();
     settings.swarm = ui->checkBoxGeneratorSwarm->isChecked();
 
-    encounterGenerator = Encounters4::getEncounters(encounter, settings, currentProfile);
+    // Settings only change the slots of an area, so the selected location is the only one that needs them applied
+    if (location)
+    {
+        auto &area = encounterGenerator[ui->comboBoxGeneratorLocation->getCurrentInt()];
+        auto areas = Encounters4::getEncounters(encounter, settings, currentProfile, area.getLocation());
+        if (!areas.empty())
+        {
+            area = areas.front();
+        }
+    }
+    else
+    {
+        encounterGenerator = Encounters4::getEncounters(encounter, settings, currentProfile);
+    }
 }
 
-void Wild4::updateEncounterSearcher()
+void Wild4::updateEncounterSearcher(bool location)
 {
     auto encounter = ui->comboBoxSearcherEncounter->getEnum<Encounter>();
 
@@ -315,7 +329,20 @@ void Wild4::updateEncounterSearcher()
     settings.time = ui->comboBoxSearcherTime->currentIndex();
     settings.swarm = ui->checkBoxSearcherSwarm->isChecked();
 
-    encounterSearcher = Encounters4::getEncounters(encounter, settings, currentProfile);
+    // Settings only change the slots of an area, so the selected location is the only one that needs them applied
+    if (location)
+    {
+        auto &area = encounterSearcher[ui->comboBoxSearcherLocation->getCurrentInt()];
+        auto areas = Encounters4::getEncounters(encounter, settings, currentProfile, area.getLocation());
+        if (!areas.empty())
+        {
+            area = areas.front();
+        }
+    }
+    else
+    {
+        encounterSearcher = Encounters4::getEncounters(encounter, settings, currentProfile);
+    }
 }
 
 void Wild4::generate()
@@ -470,14 +497,12 @@ void Wild4::generatorEncounterIndexChanged(int index)
 
 void Wild4::generatorEncounterUpdate()
 {
-    updateEncounterGenerator();
     generatorLocationIndexChanged(0);
 }
 
 void Wild4::generatorFeebasTileStateChanged(int state)
 {
     ui->filterGenerator->setEncounterSlots(state == Qt::Checked ? 6 : 5);
-    updateEncounterGenerator();
     generatorLocationIndexChanged(0);
 }
 
@@ -485,6 +510,8 @@ void Wild4::generatorLocationIndexChanged(int index)
 {
     if (index >= 0)
     {
+        updateEncounterGenerator(true);
+
         auto &area = encounterGenerator[ui->comboBoxGeneratorLocation->getCurrentInt()];
         auto species = area.getUniqueSpecies();
         auto names = area.getSpecieNames();
@@ -726,6 +753,7 @@ void Wild4::search()
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
     auto *timer = new QTimer();
+    SearchDiagnostics::attach(searcher, timer, thread);
     timer->callOnTimeout(this, [=] {
         searcherModel->addItems(searcher->getResults());
         ui->progressBar->setValue(searcher->getProgress());
@@ -844,14 +872,12 @@ void Wild4::searcherEncounterIndexChanged(int index)
 
 void Wild4::searcherEncounterUpdate()
 {
-    updateEncounterSearcher();
     searcherLocationIndexChanged(0);
 }
 
 void Wild4::searcherFeebasTileStateChanged(int state)
 {
     ui->filterSearcher->setEncounterSlots(state == Qt::Checked ? 6 : 5);
-    updateEncounterSearcher();
     searcherLocationIndexChanged(0);
 }
 
@@ -859,6 +885,8 @@ void Wild4::searcherLocationIndexChanged(int index)
 {
     if (index >= 0)
     {
+        updateEncounterSearcher(true);
+
         auto &area = encounterSearcher[ui->comboBoxSearcherLocation->getCurrentInt()];
         auto species = area.getUniqueSpecies();
         auto names = area.getSpecieNames();
@@ -74,13 +74,17 @@ private:
 
     /**
      * @brief Updates generator encounter tables
+     *
+     * @param location Whether to only rebuild the selected location
      */
-    void updateEncounterGenerator();
+    void updateEncounterGenerator(bool location = false);
 
     /**
      * @brief Update searcher encounter tables
+     *
+     * @param location Whether to only rebuild the selected location
      */
-    void updateEncounterSearcher();
+    void updateEncounterSearcher(bool location = false);
 
 private slots:
     /**
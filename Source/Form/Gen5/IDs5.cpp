@@ -28,6 +28,7 @@
 #include <Core/Util/Translator.hpp>
 #include <Core/Util/Utilities.hpp>
 #include <Form/Gen5/Profile/ProfileManager5.hpp>
+#include <Form/Util/SearchDiagnostics.hpp>
 #include <Model/Gen5/IDModel5.hpp>
 #include <QMessageBox>
 #include <QSettings>
@@ -174,6 +175,7 @@ void IDs5::search()
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
     auto *timer = new QTimer();
+    SearchDiagnostics::attach(searcher, timer, thread);
     connect(timer, &QTimer::timeout, this, [=] {
         model->addItems(searcher->getResults());
         ui->progressBar->setValue(searcher->getProgress());
@@ -28,6 +28,7 @@
 #include <Core/Util/Translator.hpp>
 #include <Form/Gen5/Profile/ProfileEditor5.hpp>
 #include <Form/Util/IVCalculator.hpp>
+#include <Form/Util/SearchDiagnostics.hpp>
 #include <Model/Gen5/ProfileSearcherModel5.hpp>
 #include <QAction>
 #include <QMessageBox>
@@ -291,6 +292,7 @@ void ProfileCalibrator5::search()
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
     auto *timer = new QTimer();
+    SearchDiagnostics::attach(searcher, timer, thread);
     connect(timer, &QTimer::timeout, this, [=] {
         model->addItems(searcher->getResults());
         ui->progressBar->setValue(searcher->getProgress());
@@ -0,0 +1,78 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SearchDiagnostics.hpp"
+#include "ui_SearchDiagnostics.h"
+#include <QSettings>
+
+SearchDiagnostics::SearchDiagnostics(QWidget *parent) : QWidget(parent), ui(new Ui::SearchDiagnostics)
+{
+    ui->setupUi(this);
+    setAttribute(Qt::WA_QuitOnClose, false);
+    setAttribute(Qt::WA_DeleteOnClose);
+
+    QStringList stages = { tr("Ability"), tr("Gender"), tr("Hidden Power"), tr("Nature"), tr("Shiny"), tr("IVs"), tr("Encounter Slot") };
+    ui->tableWidgetRejections->setRowCount(stages.size());
+    for (int i = 0; i < stages.size(); i++)
+    {
+        ui->tableWidgetRejections->setItem(i, 0, new QTableWidgetItem(stages[i]));
+        ui->tableWidgetRejections->setItem(i, 1, new QTableWidgetItem("0"));
+    }
+
+    QSettings setting;
+    if (setting.contains("searchDiagnostics/geometry"))
+    {
+        this->restoreGeometry(setting.value("searchDiagnostics/geometry").toByteArray());
+    }
+}
+
+SearchDiagnostics::~SearchDiagnostics()
+{
+    QSettings setting;
+    setting.setValue("searchDiagnostics/geometry", this->saveGeometry());
+
+    delete ui;
+}
+
+bool SearchDiagnostics::isEnabled()
+{
+    QSettings setting;
+    return setting.value("settings/diagnostics", false).toBool();
+}
+
+void SearchDiagnostics::setTelemetry(const SearchTelemetrySnapshot &telemetry)
+{
+    ui->labelElapsedValue->setText(tr("%1 s").arg(telemetry.elapsed, 0, 'f', 1));
+    ui->labelProgressRateValue->setText(tr("%1/s").arg(telemetry.progressRate, 0, 'f', 1));
+    ui->labelCandidatesValue->setText(QString::number(telemetry.candidates));
+    ui->labelHitsValue->setText(QString::number(telemetry.hits));
+    ui->labelWaitTimeValue->setText(tr("%1 s").arg(telemetry.waitTime, 0, 'f', 2));
+
+    for (size_t i = 0; i < telemetry.rejections.size(); i++)
+    {
+        ui->tableWidgetRejections->item(i, 1)->setText(QString::number(telemetry.rejections[i]));
+    }
+
+    ui->tableWidgetThreads->setRowCount(telemetry.threadUtilization.size());
+    for (size_t i = 0; i < telemetry.threadUtilization.size(); i++)
+    {
+        ui->tableWidgetThreads->setItem(i, 0, new QTableWidgetItem(QString::number(i + 1)));
+        ui->tableWidgetThreads->setItem(i, 1, new QTableWidgetItem(QString("%1%").arg(telemetry.threadUtilization[i] * 100, 0, 'f', 1)));
+    }
+}
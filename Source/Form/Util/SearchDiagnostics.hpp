@@ -0,0 +1,98 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEARCHDIAGNOSTICS_HPP
+#define SEARCHDIAGNOSTICS_HPP
+
+#include <Core/Parents/Searchers/Searcher.hpp>
+#include <QThread>
+#include <QTimer>
+#include <QWidget>
+
+namespace Ui
+{
+    class SearchDiagnostics;
+}
+
+/**
+ * @brief Shows the telemetry of a running search
+ */
+class SearchDiagnostics : public QWidget
+{
+    Q_OBJECT
+public:
+    /**
+     * @brief Construct a new SearchDiagnostics object
+     *
+     * @param parent Parent widget, which takes memory ownership
+     */
+    SearchDiagnostics(QWidget *parent = nullptr);
+
+    /**
+     * @brief Destroy the SearchDiagnostics object
+     */
+    ~SearchDiagnostics() override;
+
+    /**
+     * @brief Checks if search diagnostics are enabled in the settings
+     *
+     * @return true Diagnostics are enabled
+     * @return false Diagnostics are disabled
+     */
+    static bool isEnabled();
+
+    /**
+     * @brief Enables telemetry on the \p searcher and opens a window that follows it if diagnostics are enabled. The window
+     * is updated on every \p timer timeout and one last time when \p thread finishes. Must be called before the search is
+     * started and before \p thread finishing is connected to anything that deletes the searcher.
+     *
+     * @tparam Result Searcher result type
+     * @param searcher Searcher to collect telemetry from
+     * @param timer Timer that polls the search
+     * @param thread Thread that runs the search
+     */
+    template <class Result>
+    static void attach(SearcherBase<Result> *searcher, QTimer *timer, QThread *thread)
+    {
+        if (!isEnabled())
+        {
+            return;
+        }
+
+        searcher->enableTelemetry();
+
+        auto *diagnostics = new SearchDiagnostics();
+        connect(timer, &QTimer::timeout, diagnostics, [=] { diagnostics->setTelemetry(searcher->getTelemetry()); });
+        // Queued ahead of the timer clean up that deletes the searcher
+        connect(thread, &QThread::finished, diagnostics, [=] { diagnostics->setTelemetry(searcher->getTelemetry()); });
+        diagnostics->show();
+    }
+
+    /**
+     * @brief Displays the \p telemetry
+     *
+     * @param telemetry Telemetry snapshot of the search
+     */
+    void setTelemetry(const SearchTelemetrySnapshot &telemetry);
+
+private:
+    Ui::SearchDiagnostics *ui;
+};
+
+#endif // SEARCHDIAGNOSTICS_HPP
@@ -21,6 +21,7 @@
 #include "ui_Settings.h"
 #include <Core/Parents/ProfileLoader.hpp>
 #include <QApplication>
+#include <QCheckBox>
 #include <QFileDialog>
 #include <QHeaderView>
 #include <QMessageBox>
@@ -91,10 +92,14 @@ Settings::Settings(QWidget *parent) : QWidget(parent), ui(new Ui::Settings)
         }
     }
 
+    // Diagnostics
+    ui->checkBoxDiagnostics->setChecked(setting.value("diagnostics", false).toBool());
+
     setting.endGroup();
 
     connect(ui->comboBoxLanguage, &QComboBox::currentIndexChanged, this, &Settings::languageIndexChanged);
     connect(ui->pushButtonProfile, &QPushButton::clicked, this, &Settings::changeProfiles);
+    connect(ui->checkBoxDiagnostics, &QCheckBox::stateChanged, this, &Settings::diagnosticsStateChanged);
     connect(ui->comboBoxStyle, &QComboBox::currentIndexChanged, this, &Settings::styleIndexChanged);
     connect(ui->comboBoxTableHeaderSize, &QComboBox::currentIndexChanged, this, &Settings::tableHeaderSizeIndexChanged);
     connect(ui->comboBoxThreads, &QComboBox::currentIndexChanged, this, &Settings::threadsIndexChanged);
@@ -138,6 +143,12 @@ void Settings::changeProfiles()
     }
 }
 
+void Settings::diagnosticsStateChanged(int state)
+{
+    QSettings setting;
+    setting.setValue("settings/diagnostics", state == Qt::Checked);
+}
+
 void Settings::languageIndexChanged(int index)
 {
     if (index >= 0)
@@ -55,6 +55,13 @@ private slots:
      */
     void changeProfiles();
 
+    /**
+     * @brief Updates the saved search diagnostics settings
+     *
+     * @param state Checkbox state
+     */
+    void diagnosticsStateChanged(int state);
+
     /**
      * @brief Updates the saved language settings
      *
@@ -0,0 +1,137 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "CellCache.hpp"
+#include <Core/Util/Translator.hpp>
+#include <Core/Util/Utilities.hpp>
+#include <QHash>
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief Gets the cached string at \p index, building it with \p build on first use
+ *
+ * @param cache Cache to lookup
+ * @param index Index of the string
+ * @param build Function that returns the string to cache
+ *
+ * @return Cached string
+ */
+template <class Build>
+static const QString &lookup(std::vector<QString> &cache, size_t index, Build build)
+{
+    if (index >= cache.size())
+    {
+        cache.resize(index + 1);
+    }
+
+    QString &string = cache[index];
+    if (string.isNull())
+    {
+        string = build();
+    }
+    return string;
+}
+
+namespace CellCache
+{
+    QString ability(u8 slot, u16 ability)
+    {
+        static std::vector<QString> cache;
+        return lookup(cache, static_cast<size_t>(ability) * 3 + slot, [=] {
+            QString name = QString::fromStdString(Translator::getAbility(ability));
+            return slot == 2 ? QString("H (%1)").arg(name) : QString("%1: %2").arg(slot).arg(name);
+        });
+    }
+
+    QString characteristic(u8 characteristic)
+    {
+        static std::vector<QString> cache;
+        return lookup(cache, characteristic, [=] { return QString::fromStdString(Translator::getCharacteristic(characteristic)); });
+    }
+
+    QString chatot(u8 prng)
+    {
+        // Gen 4 and Gen 5 share the same pitch table
+        static std::vector<QString> cache;
+        return lookup(cache, prng, [=] { return QString::fromStdString(Utilities4::getChatot(prng)); });
+    }
+
+    QString gender(u8 gender)
+    {
+        static std::vector<QString> cache;
+        return lookup(cache, gender, [=] { return QString::fromStdString(Translator::getGender(gender)); });
+    }
+
+    QString hex(u64 value, int width)
+    {
+        constexpr char digits[] = "0123456789ABCDEF";
+
+        int length = 1;
+        for (u64 rest = value >> 4; rest != 0; rest >>= 4)
+        {
+            length++;
+        }
+        length = std::max(length, width);
+
+        QString string(length, Qt::Uninitialized);
+        QChar *data = string.data();
+        for (int i = length - 1; i >= 0; i--, value >>= 4)
+        {
+            data[i] = QLatin1Char(digits[value & 0xf]);
+        }
+        return string;
+    }
+
+    QString hiddenPower(u8 power)
+    {
+        static std::vector<QString> cache;
+        return lookup(cache, power, [=] { return QString::fromStdString(Translator::getHiddenPower(power)); });
+    }
+
+    QString item(u16 item)
+    {
+        static std::vector<QString> cache;
+        return lookup(cache, item, [=] { return QString::fromStdString(Translator::getItem(item)); });
+    }
+
+    QString nature(u8 nature)
+    {
+        static std::vector<QString> cache;
+        return lookup(cache, nature, [=] { return QString::fromStdString(Translator::getNature(nature)); });
+    }
+
+    QString specie(u16 specie)
+    {
+        static std::vector<QString> cache;
+        return lookup(cache, specie, [=] { return QString::fromStdString(Translator::getSpecie(specie)); });
+    }
+
+    QString specie(u16 specie, u8 form)
+    {
+        static QHash<u32, QString> cache;
+        u32 key = (static_cast<u32>(form) << 16) | specie;
+        auto it = cache.find(key);
+        if (it == cache.end())
+        {
+            it = cache.insert(key, QString::fromStdString(Translator::getSpecie(specie, form)));
+        }
+        return it.value();
+    }
+}
@@ -0,0 +1,127 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef CELLCACHE_HPP
+#define CELLCACHE_HPP
+
+#include <Core/Global.hpp>
+#include <QString>
+
+/**
+ * @brief Provides pre-built display strings for the enumerated columns of the result models.
+ * Translated strings are fixed once Translator::init has run, so each string is converted once and returned by
+ * implicit sharing afterwards. Only call from the GUI thread.
+ */
+namespace CellCache
+{
+    /**
+     * @brief Gets the display string of an ability column
+     *
+     * @param slot Ability slot (0, 1, or 2 for hidden)
+     * @param ability Ability number
+     *
+     * @return Ability string
+     */
+    QString ability(u8 slot, u16 ability);
+
+    /**
+     * @brief Gets the string for the \p characteristic
+     *
+     * @param characteristic Characteristic number
+     *
+     * @return Characteristic string
+     */
+    QString characteristic(u8 characteristic);
+
+    /**
+     * @brief Gets the chatot pitch string for the \p prng
+     *
+     * @param prng PRNG value
+     *
+     * @return Chatot pitch string
+     */
+    QString chatot(u8 prng);
+
+    /**
+     * @brief Gets the string for the \p gender
+     *
+     * @param gender Gender number
+     *
+     * @return Gender string
+     */
+    QString gender(u8 gender);
+
+    /**
+     * @brief Formats \p value as zero padded upper case hex
+     *
+     * @param value Value to format
+     * @param width Number of digits
+     *
+     * @return Hex string
+     */
+    QString hex(u64 value, int width);
+
+    /**
+     * @brief Gets the string for the hidden \p power
+     *
+     * @param power Hidden power number
+     *
+     * @return Hidden power string
+     */
+    QString hiddenPower(u8 power);
+
+    /**
+     * @brief Gets the string for the \p item
+     *
+     * @param item Item number
+     *
+     * @return Item string
+     */
+    QString item(u16 item);
+
+    /**
+     * @brief Gets the string for the \p nature
+     *
+     * @param nature Nature number
+     *
+     * @return Nature string
+     */
+    QString nature(u8 nature);
+
+    /**
+     * @brief Gets the string for the \p specie
+     *
+     * @param specie Pokemon specie
+     *
+     * @return Specie string
+     */
+    QString specie(u16 specie);
+
+    /**
+     * @brief Gets the string for the \p specie with \p form
+     *
+     * @param specie Pokemon specie
+     * @param form Pokemon form
+     *
+     * @return Specie string
+     */
+    QString specie(u16 specie, u8 form);
+}
+
+#endif // CELLCACHE_HPP
@@ -18,7 +18,7 @@
  */
 
 #include "EggModel3.hpp"
-#include <Core/Util/Translator.hpp>
+#include <Model/CellCache.hpp>
 
 EggModel3::EggModel3(QObject *parent, bool emerald) : TableModel(parent), emerald(emerald), showInheritance(false), showStats(false)
 {
@@ -52,16 +52,16 @@ QVariant EggModel3::data(const QModelIndex &index, int role) const
         case 2:
             return state.getRedraws();
         case 3:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 4:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 5:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 6:
-            return QString("%1: %2").arg(state.getAbility()).arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 7:
         case 8:
         case 9:
@@ -78,11 +78,11 @@ QVariant EggModel3::data(const QModelIndex &index, int role) const
             }
             return showStats ? state.getStat(column - 7) : state.getIV(column - 7);
         case 13:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 14:
             return state.getHiddenPowerStrength();
         case 15:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         }
     }
 
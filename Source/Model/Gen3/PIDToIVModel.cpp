@@ -19,6 +19,7 @@
 
 #include "PIDToIVModel.hpp"
 #include <Core/Enum/Method.hpp>
+#include <Model/CellCache.hpp>
 
 PIDToIVModel::PIDToIVModel(QObject *parent) : TableModel(parent)
 {
@@ -37,7 +38,7 @@ QVariant PIDToIVModel::data(const QModelIndex &index, int role) const
         switch (index.column())
         {
         case 0:
-            return QString::number(state.getSeed(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getSeed(), 8);
         case 1:
             switch (state.getMethod())
             {
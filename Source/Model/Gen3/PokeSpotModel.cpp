@@ -18,7 +18,7 @@
  */
 
 #include "PokeSpotModel.hpp"
-#include <Core/Util/Translator.hpp>
+#include <Model/CellCache.hpp>
 
 PokeSpotModel::PokeSpotModel(QObject *parent) : TableModel(parent), showStats(false)
 {
@@ -42,20 +42,20 @@ QVariant PokeSpotModel::data(const QModelIndex &index, int role) const
         case 1:
             return state.getEncounterAdvances();
         case 2:
-            return QString("%1: %2").arg(state.getEncounterSlot()).arg(QString::fromStdString(Translator::getSpecie(state.getSpecie())));
+            return QString("%1: %2").arg(state.getEncounterSlot()).arg(CellCache::specie(state.getSpecie()));
         case 3:
             return state.getLevel();
         case 4:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 5:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 6:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 7:
-            return QString("%1: %2").arg(state.getAbility()).arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 8:
         case 9:
         case 10:
@@ -64,11 +64,11 @@ QVariant PokeSpotModel::data(const QModelIndex &index, int role) const
         case 13:
             return showStats ? state.getStat(column - 8) : state.getIV(column - 8);
         case 14:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 15:
             return state.getHiddenPowerStrength();
         case 16:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         }
     }
     return QVariant();
@@ -18,7 +18,8 @@
  */
 
 #include "StaticModel3.hpp"
-#include <Core/Util/Translator.hpp>
+#include <Core/Util/RadixSort.hpp>
+#include <Model/CellCache.hpp>
 
 StaticGeneratorModel3::StaticGeneratorModel3(QObject *parent) : TableModel(parent), showStats(false)
 {
@@ -40,16 +41,16 @@ QVariant StaticGeneratorModel3::data(const QModelIndex &index, int role) const
         case 0:
             return state.getAdvances();
         case 1:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 2:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 3:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 4:
-            return QString("%1: %2").arg(state.getAbility()).arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 5:
         case 6:
         case 7:
@@ -58,11 +59,11 @@ QVariant StaticGeneratorModel3::data(const QModelIndex &index, int role) const
         case 10:
             return showStats ? state.getStat(column - 5) : state.getIV(column - 5);
         case 11:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 12:
             return state.getHiddenPowerStrength();
         case 13:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         }
     }
     return QVariant();
@@ -101,18 +102,18 @@ QVariant StaticSearcherModel3::data(const QModelIndex &index, int role) const
         switch (column)
         {
         case 0:
-            return QString::number(state.getSeed(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getSeed(), 8);
         case 1:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 2:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 3:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 4:
-            return QString("%1: %2").arg(state.getAbility()).arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 5:
         case 6:
         case 7:
@@ -121,11 +122,11 @@ QVariant StaticSearcherModel3::data(const QModelIndex &index, int role) const
         case 10:
             return showStats ? state.getStat(column - 5) : state.getIV(column - 5);
         case 11:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 12:
             return state.getHiddenPowerStrength();
         case 13:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         }
     }
     return QVariant();
@@ -149,29 +150,19 @@ void StaticSearcherModel3::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](SearcherState &state1, SearcherState &state2) {
-                return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState &state) { return state.getSeed(); });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](SearcherState &state1, SearcherState &state2) {
-                return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState &state) { return state.getPID(); });
             break;
         case 2:
-            std::sort(model.begin(), model.end(), [flag](SearcherState &state1, SearcherState &state2) {
-                return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState &state) { return state.getShiny(); });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](SearcherState &state1, SearcherState &state2) {
-                return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState &state) { return state.getNature(); });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](SearcherState &state1, SearcherState &state2) {
-                return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState &state) { return state.getAbility(); });
             break;
         case 5:
         case 6:
@@ -179,25 +170,16 @@ void StaticSearcherModel3::sort(int column, Qt::SortOrder order)
         case 8:
         case 9:
         case 10:
-            std::sort(model.begin(), model.end(), [flag, column](SearcherState &state1, SearcherState &state2) {
-                return flag ? state1.getIV(column - 5) < state2.getIV(column - 5) : state1.getIV(column - 5) > state2.getIV(column - 5);
-            });
+            RadixSort::sortBy(model, flag, [column](const SearcherState &state) { return state.getIV(column - 5); });
             break;
         case 11:
-            std::sort(model.begin(), model.end(), [flag](SearcherState &state1, SearcherState &state2) {
-                return flag ? state1.getHiddenPower() < state2.getHiddenPower() : state1.getHiddenPower() > state2.getHiddenPower();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState &state) { return state.getHiddenPower(); });
             break;
         case 12:
-            std::sort(model.begin(), model.end(), [flag](SearcherState &state1, SearcherState &state2) {
-                return flag ? state1.getHiddenPowerStrength() < state2.getHiddenPowerStrength()
-                            : state1.getHiddenPowerStrength() > state2.getHiddenPowerStrength();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState &state) { return state.getHiddenPowerStrength(); });
             break;
         case 13:
-            std::sort(model.begin(), model.end(), [flag](SearcherState &state1, SearcherState &state2) {
-                return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState &state) { return state.getGender(); });
             break;
         }
 
@@ -18,7 +18,9 @@
  */
 
 #include "WildModel3.hpp"
-#include <Core/Util/Translator.hpp>
+#include <Core/Enum/Lead.hpp>
+#include <Core/Util/RadixSort.hpp>
+#include <Model/CellCache.hpp>
 
 WildGeneratorModel3::WildGeneratorModel3(QObject *parent) : TableModel(parent), showStats(false)
 {
@@ -40,22 +42,20 @@ QVariant WildGeneratorModel3::data(const QModelIndex &index, int role) const
         case 0:
             return state.getAdvances();
         case 1:
-            return QString("%1: %2")
-                .arg(state.getEncounterSlot())
-                .arg(QString::fromStdString(Translator::getSpecie(state.getSpecie(), state.getForm())));
+            return QString("%1: %2").arg(state.getEncounterSlot()).arg(CellCache::specie(state.getSpecie(), state.getForm()));
         case 2:
             return state.getLevel();
         case 3:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 4:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 5:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 6:
-            return QString("%1: %2").arg(state.getAbility()).arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 7:
         case 8:
         case 9:
@@ -64,11 +64,11 @@ QVariant WildGeneratorModel3::data(const QModelIndex &index, int role) const
         case 12:
             return showStats ? state.getStat(column - 7) : state.getIV(column - 7);
         case 13:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 14:
             return state.getHiddenPowerStrength();
         case 15:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         }
     }
     return QVariant();
@@ -95,7 +95,7 @@ WildSearcherModel3::WildSearcherModel3(QObject *parent) : TableModel(parent), sh
 
 int WildSearcherModel3::columnCount(const QModelIndex &parent) const
 {
-    return 16;
+    return 17;
 }
 
 QVariant WildSearcherModel3::data(const QModelIndex &index, int role) const
@@ -107,24 +107,22 @@ QVariant WildSearcherModel3::data(const QModelIndex &index, int role) const
         switch (column)
         {
         case 0:
-            return QString::number(state.getSeed(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getSeed(), 8);
         case 1:
-            return QString("%1: %2")
-                .arg(state.getEncounterSlot())
-                .arg(QString::fromStdString(Translator::getSpecie(state.getSpecie(), state.getForm())));
+            return QString("%1: %2").arg(state.getEncounterSlot()).arg(CellCache::specie(state.getSpecie(), state.getForm()));
         case 2:
             return state.getLevel();
         case 3:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 4:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 5:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 6:
-            return QString("%1: %2").arg(state.getAbility()).arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 7:
         case 8:
         case 9:
@@ -133,11 +131,31 @@ QVariant WildSearcherModel3::data(const QModelIndex &index, int role) const
         case 12:
             return showStats ? state.getStat(column - 7) : state.getIV(column - 7);
         case 13:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 14:
             return state.getHiddenPowerStrength();
         case 15:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
+        case 16:
+            switch (state.getLead())
+            {
+            case Lead::None:
+                return tr("None");
+            case Lead::Synchronize:
+                return tr("Synchronize");
+            case Lead::CuteCharmM:
+                return tr("♂ Cute Charm");
+            case Lead::CuteCharmF:
+                return tr("♀ Cute Charm");
+            case Lead::MagnetPull:
+                return tr("Magnet Pull");
+            case Lead::Static:
+                return tr("Static");
+            case Lead::Pressure:
+                return tr("Level Modifier");
+            default:
+                return QVariant();
+            }
         }
     }
     return QVariant();
@@ -161,39 +179,25 @@ void WildSearcherModel3::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState &state1, const WildSearcherState &state2) {
-                return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState &state) { return state.getSeed(); });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState &state1, const WildSearcherState &state2) {
-                return flag ? state1.getEncounterSlot() < state2.getEncounterSlot() : state1.getEncounterSlot() > state2.getEncounterSlot();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState &state) { return state.getEncounterSlot(); });
             break;
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState &state1, const WildSearcherState &state2) {
-                return flag ? state1.getLevel() < state2.getLevel() : state1.getLevel() > state2.getLevel();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState &state) { return state.getLevel(); });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState &state1, const WildSearcherState &state2) {
-                return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState &state) { return state.getPID(); });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState &state1, const WildSearcherState &state2) {
-                return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState &state) { return state.getShiny(); });
             break;
         case 5:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState &state1, const WildSearcherState &state2) {
-                return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState &state) { return state.getNature(); });
             break;
         case 6:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState &state1, const WildSearcherState &state2) {
-                return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState &state) { return state.getAbility(); });
             break;
         case 7:
         case 8:
@@ -201,25 +205,19 @@ void WildSearcherModel3::sort(int column, Qt::SortOrder order)
         case 10:
         case 11:
         case 12:
-            std::sort(model.begin(), model.end(), [flag, column](const WildSearcherState &state1, const WildSearcherState &state2) {
-                return flag ? state1.getIV(column - 7) < state2.getIV(column - 7) : state1.getIV(column - 7) > state2.getIV(column - 7);
-            });
+            RadixSort::sortBy(model, flag, [column](const WildSearcherState &state) { return state.getIV(column - 7); });
             break;
         case 13:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState &state1, const WildSearcherState &state2) {
-                return flag ? state1.getHiddenPower() < state2.getHiddenPower() : state1.getHiddenPower() > state2.getHiddenPower();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState &state) { return state.getHiddenPower(); });
             break;
         case 14:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState &state1, const WildSearcherState &state2) {
-                return flag ? state1.getHiddenPowerStrength() < state2.getHiddenPowerStrength()
-                            : state1.getHiddenPowerStrength() > state2.getHiddenPowerStrength();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState &state) { return state.getHiddenPowerStrength(); });
             break;
         case 15:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState &state1, const WildSearcherState &state2) {
-                return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState &state) { return state.getGender(); });
+            break;
+        case 16:
+            RadixSort::sortBy(model, flag, [](const WildSearcherState &state) { return toInt(state.getLead()); });
             break;
         }
 
@@ -19,8 +19,8 @@
 
 #include "EggModel4.hpp"
 #include <Core/Enum/Game.hpp>
-#include <Core/Util/Translator.hpp>
-#include <Core/Util/Utilities.hpp>
+#include <Core/Util/RadixSort.hpp>
+#include <Model/CellCache.hpp>
 
 EggGeneratorModel4::EggGeneratorModel4(QObject *parent, Game version) :
     TableModel(parent), dppt((version & Game::DPPt) != Game::None), showInheritance(false), showStats(false)
@@ -54,18 +54,18 @@ QVariant EggGeneratorModel4::data(const QModelIndex &index, int role) const
         case 2:
             return state.getCall() == 0 ? "E" : state.getCall() == 1 ? "K" : "P";
         case 3:
-            return QString::fromStdString(Utilities4::getChatot(state.getChatot()));
+            return CellCache::chatot(state.getChatot());
         case 4:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 5:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 6:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 7:
-            return QString("%1: %2").arg(state.getAbility()).arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 8:
         case 9:
         case 10:
@@ -82,13 +82,13 @@ QVariant EggGeneratorModel4::data(const QModelIndex &index, int role) const
             }
             return showStats ? state.getStat(column - 8) : state.getIV(column - 8);
         case 14:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 15:
             return state.getHiddenPowerStrength();
         case 16:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         case 17:
-            return QString::fromStdString(Translator::getCharacteristic(state.getCharacteristic()));
+            return CellCache::characteristic(state.getCharacteristic());
         }
     }
 
@@ -155,22 +155,22 @@ QVariant EggSearcherModel4::data(const QModelIndex &index, int role) const
         switch (column)
         {
         case 0:
-            return QString::number(display.getSeed(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(display.getSeed(), 8);
         case 1:
             return state.getAdvances();
         case 2:
             return state.getPickupAdvances();
         case 3:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 4:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 5:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 6:
-            return QString("%1: %2").arg(state.getAbility()).arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 7:
         case 8:
         case 9:
@@ -187,13 +187,13 @@ QVariant EggSearcherModel4::data(const QModelIndex &index, int role) const
             }
             return showStats ? state.getStat(column - 7) : state.getIV(column - 7);
         case 13:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 14:
             return state.getHiddenPowerStrength();
         case 15:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         case 16:
-            return QString::fromStdString(Translator::getCharacteristic(state.getCharacteristic()));
+            return CellCache::characteristic(state.getCharacteristic());
         }
     }
     return QVariant();
@@ -217,45 +217,25 @@ void EggSearcherModel4::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const EggSearcherState4 &state1, const EggSearcherState4 &state2) {
-                return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
-            });
+            RadixSort::sortBy(model, flag, [](const EggSearcherState4 &state) { return state.getSeed(); });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](const EggSearcherState4 &state1, const EggSearcherState4 &state2) {
-                return flag ? state1.getState().getAdvances() < state2.getState().getAdvances()
-                            : state1.getState().getAdvances() > state2.getState().getAdvances();
-            });
+            RadixSort::sortBy(model, flag, [](const EggSearcherState4 &state) { return state.getState().getAdvances(); });
             break;
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const EggSearcherState4 &state1, const EggSearcherState4 &state2) {
-                return flag ? state1.getState().getPickupAdvances() < state2.getState().getPickupAdvances()
-                            : state1.getState().getPickupAdvances() > state2.getState().getPickupAdvances();
-            });
+            RadixSort::sortBy(model, flag, [](const EggSearcherState4 &state) { return state.getState().getPickupAdvances(); });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](const EggSearcherState4 &state1, const EggSearcherState4 &state2) {
-                return flag ? state1.getState().getPID() < state2.getState().getPID()
-                            : state1.getState().getPID() > state2.getState().getPID();
-            });
+            RadixSort::sortBy(model, flag, [](const EggSearcherState4 &state) { return state.getState().getPID(); });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const EggSearcherState4 &state1, const EggSearcherState4 &state2) {
-                return flag ? state1.getState().getShiny() < state2.getState().getShiny()
-                            : state1.getState().getShiny() > state2.getState().getShiny();
-            });
+            RadixSort::sortBy(model, flag, [](const EggSearcherState4 &state) { return state.getState().getShiny(); });
             break;
         case 5:
-            std::sort(model.begin(), model.end(), [flag](const EggSearcherState4 &state1, const EggSearcherState4 &state2) {
-                return flag ? state1.getState().getNature() < state2.getState().getNature()
-                            : state1.getState().getNature() > state2.getState().getNature();
-            });
+            RadixSort::sortBy(model, flag, [](const EggSearcherState4 &state) { return state.getState().getNature(); });
             break;
         case 6:
-            std::sort(model.begin(), model.end(), [flag](const EggSearcherState4 &state1, const EggSearcherState4 &state2) {
-                return flag ? state1.getState().getAbility() < state2.getState().getAbility()
-                            : state1.getState().getAbility() > state2.getState().getAbility();
-            });
+            RadixSort::sortBy(model, flag, [](const EggSearcherState4 &state) { return state.getState().getAbility(); });
             break;
         case 7:
         case 8:
@@ -263,34 +243,19 @@ void EggSearcherModel4::sort(int column, Qt::SortOrder order)
         case 10:
         case 11:
         case 12:
-            std::sort(model.begin(), model.end(), [flag, column](const EggSearcherState4 &state1, const EggSearcherState4 &state2) {
-                return flag ? state1.getState().getIV(column - 7) < state2.getState().getIV(column - 7)
-                            : state1.getState().getIV(column - 7) > state2.getState().getIV(column - 7);
-            });
+            RadixSort::sortBy(model, flag, [column](const EggSearcherState4 &state) { return state.getState().getIV(column - 7); });
             break;
         case 13:
-            std::sort(model.begin(), model.end(), [flag](const EggSearcherState4 &state1, const EggSearcherState4 &state2) {
-                return flag ? state1.getState().getHiddenPower() < state2.getState().getHiddenPower()
-                            : state1.getState().getHiddenPower() > state2.getState().getHiddenPower();
-            });
+            RadixSort::sortBy(model, flag, [](const EggSearcherState4 &state) { return state.getState().getHiddenPower(); });
             break;
         case 14:
-            std::sort(model.begin(), model.end(), [flag](const EggSearcherState4 &state1, const EggSearcherState4 &state2) {
-                return flag ? state1.getState().getHiddenPowerStrength() < state2.getState().getHiddenPowerStrength()
-                            : state1.getState().getHiddenPowerStrength() > state2.getState().getHiddenPowerStrength();
-            });
+            RadixSort::sortBy(model, flag, [](const EggSearcherState4 &state) { return state.getState().getHiddenPowerStrength(); });
             break;
         case 15:
-            std::sort(model.begin(), model.end(), [flag](const EggSearcherState4 &state1, const EggSearcherState4 &state2) {
-                return flag ? state1.getState().getGender() < state2.getState().getGender()
-                            : state1.getState().getGender() > state2.getState().getGender();
-            });
+            RadixSort::sortBy(model, flag, [](const EggSearcherState4 &state) { return state.getState().getGender(); });
             break;
         case 16:
-            std::sort(model.begin(), model.end(), [flag](const EggSearcherState4 &state1, const EggSearcherState4 &state2) {
-                return flag ? state1.getState().getCharacteristic() < state2.getState().getCharacteristic()
-                            : state1.getState().getCharacteristic() > state2.getState().getCharacteristic();
-            });
+            RadixSort::sortBy(model, flag, [](const EggSearcherState4 &state) { return state.getState().getCharacteristic(); });
             break;
         }
 
@@ -19,7 +19,8 @@
 
 #include "EventModel4.hpp"
 #include <Core/Enum/Game.hpp>
-#include <Core/Util/Translator.hpp>
+#include <Core/Util/RadixSort.hpp>
+#include <Model/CellCache.hpp>
 
 EventGeneratorModel4::EventGeneratorModel4(QObject *parent) : TableModel(parent), version(Game::DPPt), showStats(false)
 {
@@ -59,7 +60,7 @@ QVariant EventGeneratorModel4::data(const QModelIndex &index, int role) const
         case 8:
             return showStats ? state.getStat(column - 3) : state.getIV(column - 3);
         case 9:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 10:
             return state.getHiddenPowerStrength();
         }
@@ -121,7 +122,7 @@ QVariant EventSearcherModel4::data(const QModelIndex &index, int role) const
         switch (column)
         {
         case 0:
-            return QString::number(state.getSeed(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getSeed(), 8);
         case 1:
             return state.getAdvances();
         case 2:
@@ -132,7 +133,7 @@ QVariant EventSearcherModel4::data(const QModelIndex &index, int role) const
         case 7:
             return showStats ? state.getStat(column - 2) : state.getIV(column - 2);
         case 8:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 9:
             return state.getHiddenPowerStrength();
         }
@@ -159,14 +160,10 @@ void EventSearcherModel4::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState4 &state) { return state.getSeed(); });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getAdvances() < state2.getAdvances() : state1.getAdvances() > state2.getAdvances();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState4 &state) { return state.getAdvances(); });
             break;
         case 2:
         case 3:
@@ -174,20 +171,13 @@ void EventSearcherModel4::sort(int column, Qt::SortOrder order)
         case 5:
         case 6:
         case 7:
-            std::sort(model.begin(), model.end(), [flag, column](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getIV(column - 6) < state2.getIV(column - 6) : state1.getIV(column - 6) > state2.getIV(column - 6);
-            });
+            RadixSort::sortBy(model, flag, [column](const SearcherState4 &state) { return state.getIV(column - 6); });
             break;
         case 8:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getHiddenPower() < state2.getHiddenPower() : state1.getHiddenPower() > state2.getHiddenPower();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState4 &state) { return state.getHiddenPower(); });
             break;
         case 9:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getHiddenPowerStrength() < state2.getHiddenPowerStrength()
-                            : state1.getHiddenPowerStrength() > state2.getHiddenPowerStrength();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState4 &state) { return state.getHiddenPowerStrength(); });
             break;
         }
     }
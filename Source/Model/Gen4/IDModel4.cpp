@@ -18,6 +18,7 @@
  */
 
 #include "IDModel4.hpp"
+#include <Model/CellCache.hpp>
 
 IDModel4::IDModel4(QObject *parent, bool flag) : TableModel(parent), showSeconds(flag)
 {
@@ -37,7 +38,7 @@ QVariant IDModel4::data(const QModelIndex &index, int role) const
         switch (column)
         {
         case 0:
-            return QString::number(state.getSeed(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getSeed(), 8);
         case 1:
             return state.getTID();
         case 2:
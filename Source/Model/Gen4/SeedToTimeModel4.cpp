@@ -19,7 +19,7 @@
 
 #include "SeedToTimeModel4.hpp"
 #include <Core/Gen4/HGSSRoamer.hpp>
-#include <Core/Util/Utilities.hpp>
+#include <Model/CellCache.hpp>
 
 SeedToTimeModel4::SeedToTimeModel4(QObject *parent) : TableModel(parent)
 {
@@ -73,7 +73,7 @@ QVariant SeedToTimeCalibrateModel4::data(const QModelIndex &index, int role) con
         switch (column)
         {
         case 0:
-            return QString::number(state.getSeed(), 16).toUpper().toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getSeed(), 8);
         case 1:
             return QString::fromStdString(state.getDateTime().toString());
         case 2:
@@ -19,8 +19,8 @@
 
 #include "StaticModel4.hpp"
 #include <Core/Enum/Method.hpp>
-#include <Core/Util/Translator.hpp>
-#include <Core/Util/Utilities.hpp>
+#include <Core/Util/RadixSort.hpp>
+#include <Model/CellCache.hpp>
 
 StaticGeneratorModel4::StaticGeneratorModel4(QObject *parent, Method method) : TableModel(parent), showStats(false), method(method)
 {
@@ -53,18 +53,18 @@ QVariant StaticGeneratorModel4::data(const QModelIndex &index, int role) const
         case 1:
             return state.getCall() == 0 ? "E" : state.getCall() == 1 ? "K" : "P";
         case 2:
-            return QString::fromStdString(Utilities4::getChatot(state.getChatot()));
+            return CellCache::chatot(state.getChatot());
         case 3:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 4:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 5:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 6:
-            return QString("%1: %2").arg(state.getAbility()).arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 7:
         case 8:
         case 9:
@@ -73,13 +73,13 @@ QVariant StaticGeneratorModel4::data(const QModelIndex &index, int role) const
         case 12:
             return showStats ? state.getStat(column - 7) : state.getIV(column - 7);
         case 13:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 14:
             return state.getHiddenPowerStrength();
         case 15:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         case 16:
-            return QString::fromStdString(Translator::getCharacteristic(state.getCharacteristic()));
+            return CellCache::characteristic(state.getCharacteristic());
         }
     }
     return QVariant();
@@ -139,20 +139,20 @@ QVariant StaticSearcherModel4::data(const QModelIndex &index, int role) const
         switch (column)
         {
         case 0:
-            return QString::number(state.getSeed(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getSeed(), 8);
         case 1:
             return state.getAdvances();
         case 2:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 3:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 4:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 5:
-            return QString("%1: %2").arg(state.getAbility()).arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 6:
         case 7:
         case 8:
@@ -161,13 +161,13 @@ QVariant StaticSearcherModel4::data(const QModelIndex &index, int role) const
         case 11:
             return showStats ? state.getStat(column - 6) : state.getIV(column - 6);
         case 12:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 13:
             return state.getHiddenPowerStrength();
         case 14:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         case 15:
-            return QString::fromStdString(Translator::getCharacteristic(state.getCharacteristic()));
+            return CellCache::characteristic(state.getCharacteristic());
         }
     }
     return QVariant();
@@ -191,34 +191,22 @@ void StaticSearcherModel4::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState4 &state) { return state.getSeed(); });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getAdvances() < state2.getAdvances() : state1.getAdvances() > state2.getAdvances();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState4 &state) { return state.getAdvances(); });
             break;
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState4 &state) { return state.getPID(); });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState4 &state) { return state.getShiny(); });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState4 &state) { return state.getNature(); });
             break;
         case 5:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState4 &state) { return state.getAbility(); });
             break;
         case 6:
         case 7:
@@ -226,31 +214,19 @@ void StaticSearcherModel4::sort(int column, Qt::SortOrder order)
         case 9:
         case 10:
         case 11:
-            std::sort(model.begin(), model.end(), [flag, column](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getIV(column - 6) < state2.getIV(column - 6) : state1.getIV(column - 6) > state2.getIV(column - 6);
-            });
+            RadixSort::sortBy(model, flag, [column](const SearcherState4 &state) { return state.getIV(column - 6); });
             break;
         case 12:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getHiddenPower() < state2.getHiddenPower() : state1.getHiddenPower() > state2.getHiddenPower();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState4 &state) { return state.getHiddenPower(); });
             break;
         case 13:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getHiddenPowerStrength() < state2.getHiddenPowerStrength()
-                            : state1.getHiddenPowerStrength() > state2.getHiddenPowerStrength();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState4 &state) { return state.getHiddenPowerStrength(); });
             break;
         case 14:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState4 &state) { return state.getGender(); });
             break;
         case 15:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState4 &state1, const SearcherState4 &state2) {
-                return flag ? state1.getCharacteristic() < state2.getCharacteristic()
-                            : state1.getCharacteristic() > state2.getCharacteristic();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState4 &state) { return state.getCharacteristic(); });
             break;
         }
 
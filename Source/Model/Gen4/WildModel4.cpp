@@ -19,8 +19,8 @@
 
 #include "WildModel4.hpp"
 #include <Core/Enum/Method.hpp>
-#include <Core/Util/Translator.hpp>
-#include <Core/Util/Utilities.hpp>
+#include <Core/Util/RadixSort.hpp>
+#include <Model/CellCache.hpp>
 
 WildGeneratorModel4::WildGeneratorModel4(QObject *parent, Method method) : TableModel(parent), showStats(false), method(method)
 {
@@ -55,26 +55,24 @@ QVariant WildGeneratorModel4::data(const QModelIndex &index, int role) const
         case 2:
             return state.getCall() == 0 ? "E" : state.getCall() == 1 ? "K" : "P";
         case 3:
-            return QString::fromStdString(Utilities4::getChatot(state.getChatot()));
+            return CellCache::chatot(state.getChatot());
         case 4:
-            return QString::fromStdString(Translator::getItem(state.getItem()));
+            return CellCache::item(state.getItem());
         case 5:
-            return QString("%1: %2")
-                .arg(state.getEncounterSlot())
-                .arg(QString::fromStdString(Translator::getSpecie(state.getSpecie(), state.getForm())));
+            return QString("%1: %2").arg(state.getEncounterSlot()).arg(CellCache::specie(state.getSpecie(), state.getForm()));
         case 6:
             return state.getLevel();
         case 7:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 8:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 9:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 10:
-            return QString("%1: %2").arg(state.getAbility()).arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 11:
         case 12:
         case 13:
@@ -83,13 +81,13 @@ QVariant WildGeneratorModel4::data(const QModelIndex &index, int role) const
         case 16:
             return showStats ? state.getStat(column - 11) : state.getIV(column - 11);
         case 17:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 18:
             return state.getHiddenPowerStrength();
         case 19:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         case 20:
-            return QString::fromStdString(Translator::getCharacteristic(state.getCharacteristic()));
+            return CellCache::characteristic(state.getCharacteristic());
         }
     }
     return QVariant();
@@ -149,28 +147,26 @@ QVariant WildSearcherModel4::data(const QModelIndex &index, int role) const
         switch (column)
         {
         case 0:
-            return QString::number(state.getSeed(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getSeed(), 8);
         case 1:
             return state.getAdvances();
         case 2:
-            return QString::fromStdString(Translator::getItem(state.getItem()));
+            return CellCache::item(state.getItem());
         case 3:
-            return QString("%1: %2")
-                .arg(state.getEncounterSlot())
-                .arg(QString::fromStdString(Translator::getSpecie(state.getSpecie(), state.getForm())));
+            return QString("%1: %2").arg(state.getEncounterSlot()).arg(CellCache::specie(state.getSpecie(), state.getForm()));
         case 4:
             return state.getLevel();
         case 5:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 6:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 7:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 8:
-            return QString("%1: %2").arg(state.getAbility()).arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 9:
         case 10:
         case 11:
@@ -179,13 +175,13 @@ QVariant WildSearcherModel4::data(const QModelIndex &index, int role) const
         case 14:
             return showStats ? state.getStat(column - 9) : state.getIV(column - 9);
         case 15:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 16:
             return state.getHiddenPowerStrength();
         case 17:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         case 18:
-            return QString::fromStdString(Translator::getCharacteristic(state.getCharacteristic()));
+            return CellCache::characteristic(state.getCharacteristic());
         }
     }
     return QVariant();
@@ -209,49 +205,31 @@ void WildSearcherModel4::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState4 &state1, const WildSearcherState4 &state2) {
-                return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState4 &state) { return state.getSeed(); });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState4 &state1, const WildSearcherState4 &state2) {
-                return flag ? state1.getAdvances() < state2.getAdvances() : state1.getAdvances() > state2.getAdvances();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState4 &state) { return state.getAdvances(); });
             break;
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState4 &state1, const WildSearcherState4 &state2) {
-                return flag ? state1.getItem() > state2.getItem() : state1.getItem() < state2.getItem();
-            });
+            RadixSort::sortBy(model, !flag, [](const WildSearcherState4 &state) { return state.getItem(); });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState4 &state1, const WildSearcherState4 &state2) {
-                return flag ? state1.getEncounterSlot() < state2.getEncounterSlot() : state1.getEncounterSlot() > state2.getEncounterSlot();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState4 &state) { return state.getEncounterSlot(); });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState4 &state1, const WildSearcherState4 &state2) {
-                return flag ? state1.getLevel() < state2.getLevel() : state1.getLevel() > state2.getLevel();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState4 &state) { return state.getLevel(); });
             break;
         case 5:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState4 &state1, const WildSearcherState4 &state2) {
-                return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState4 &state) { return state.getPID(); });
             break;
         case 6:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState4 &state1, const WildSearcherState4 &state2) {
-                return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState4 &state) { return state.getShiny(); });
             break;
         case 7:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState4 &state1, const WildSearcherState4 &state2) {
-                return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState4 &state) { return state.getNature(); });
             break;
         case 8:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState4 &state1, const WildSearcherState4 &state2) {
-                return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState4 &state) { return state.getAbility(); });
             break;
         case 9:
         case 10:
@@ -259,31 +237,19 @@ void WildSearcherModel4::sort(int column, Qt::SortOrder order)
         case 12:
         case 13:
         case 14:
-            std::sort(model.begin(), model.end(), [flag, column](const WildSearcherState4 &state1, const WildSearcherState4 &state2) {
-                return flag ? state1.getIV(column - 9) < state2.getIV(column - 9) : state1.getIV(column - 9) > state2.getIV(column - 9);
-            });
+            RadixSort::sortBy(model, flag, [column](const WildSearcherState4 &state) { return state.getIV(column - 9); });
             break;
         case 15:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState4 &state1, const WildSearcherState4 &state2) {
-                return flag ? state1.getHiddenPower() < state2.getHiddenPower() : state1.getHiddenPower() > state2.getHiddenPower();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState4 &state) { return state.getHiddenPower(); });
             break;
         case 16:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState4 &state1, const WildSearcherState4 &state2) {
-                return flag ? state1.getHiddenPowerStrength() < state2.getHiddenPowerStrength()
-                            : state1.getHiddenPowerStrength() > state2.getHiddenPowerStrength();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState4 &state) { return state.getHiddenPowerStrength(); });
             break;
         case 17:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState4 &state1, const WildSearcherState4 &state2) {
-                return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState4 &state) { return state.getGender(); });
             break;
         case 18:
-            std::sort(model.begin(), model.end(), [flag](const WildSearcherState4 &state1, const WildSearcherState4 &state2) {
-                return flag ? state1.getCharacteristic() < state2.getCharacteristic()
-                            : state1.getCharacteristic() > state2.getCharacteristic();
-            });
+            RadixSort::sortBy(model, flag, [](const WildSearcherState4 &state) { return state.getCharacteristic(); });
             break;
         }
 
@@ -18,7 +18,9 @@
  */
 
 #include "DreamRadarModel.hpp"
+#include <Core/Util/RadixSort.hpp>
 #include <Core/Util/Translator.hpp>
+#include <Model/CellCache.hpp>
 
 static const QStringList needleStrings = { "↑", "↗", "→", "↘", "↓", "↙", "←", "↖" };
 
@@ -44,25 +46,16 @@ QVariant DreamRadarGeneratorModel5::data(const QModelIndex &index, int role) con
         case 1:
             return needleStrings[state.getNeedle()];
         case 2:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 3:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 4:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 5:
-            if (state.getAbility() == 0 || state.getAbility() == 1)
-            {
-                return QString("%1: %2")
-                    .arg(state.getAbility())
-                    .arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
-            else
-            {
-                return QString("H (%2)").arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 6:
         case 7:
         case 8:
@@ -71,13 +64,13 @@ QVariant DreamRadarGeneratorModel5::data(const QModelIndex &index, int role) con
         case 11:
             return showStats ? state.getStat(column - 6) : state.getIV(column - 6);
         case 12:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 13:
             return state.getHiddenPowerStrength();
         case 14:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         case 15:
-            return QString::fromStdString(Translator::getCharacteristic(state.getCharacteristic()));
+            return CellCache::characteristic(state.getCharacteristic());
         }
     }
     return QVariant();
@@ -118,29 +111,20 @@ QVariant DreamRadarSearcherModel5::data(const QModelIndex &index, int role) cons
         switch (column)
         {
         case 0:
-            return QString::number(display.getInitialSeed(), 16).toUpper().rightJustified(16, '0');
+            return CellCache::hex(display.getInitialSeed(), 16);
         case 1:
             return state.getAdvances();
         case 2:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 3:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 4:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 5:
-            if (state.getAbility() == 0 || state.getAbility() == 1)
-            {
-                return QString("%1: %2")
-                    .arg(state.getAbility())
-                    .arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
-            else
-            {
-                return QString("H (%2)").arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 6:
         case 7:
         case 8:
@@ -149,11 +133,11 @@ QVariant DreamRadarSearcherModel5::data(const QModelIndex &index, int role) cons
         case 11:
             return showStats ? state.getStat(column - 6) : state.getIV(column - 6);
         case 12:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 13:
             return state.getHiddenPowerStrength();
         case 14:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         case 15:
             return QString::fromStdString(display.getDateTime().toString());
         case 16:
@@ -183,46 +167,22 @@ void DreamRadarSearcherModel5::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<DreamRadarState> &state1, const SearcherState5<DreamRadarState> &state2) {
-                          return flag ? state1.getInitialSeed() < state2.getInitialSeed()
-                                      : state1.getInitialSeed() > state2.getInitialSeed();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<DreamRadarState> &state) { return state.getInitialSeed(); });
             break;
         case 1:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<DreamRadarState> &state1, const SearcherState5<DreamRadarState> &state2) {
-                          return flag ? state1.getState().getAdvances() < state2.getState().getAdvances()
-                                      : state1.getState().getAdvances() > state2.getState().getAdvances();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<DreamRadarState> &state) { return state.getState().getAdvances(); });
             break;
         case 2:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<DreamRadarState> &state1, const SearcherState5<DreamRadarState> &state2) {
-                          return flag ? state1.getState().getPID() < state2.getState().getPID()
-                                      : state1.getState().getPID() > state2.getState().getPID();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<DreamRadarState> &state) { return state.getState().getPID(); });
             break;
         case 3:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<DreamRadarState> &state1, const SearcherState5<DreamRadarState> &state2) {
-                          return flag ? state1.getState().getShiny() < state2.getState().getShiny()
-                                      : state1.getState().getShiny() > state2.getState().getShiny();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<DreamRadarState> &state) { return state.getState().getShiny(); });
             break;
         case 4:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<DreamRadarState> &state1, const SearcherState5<DreamRadarState> &state2) {
-                          return flag ? state1.getState().getNature() < state2.getState().getNature()
-                                      : state1.getState().getNature() > state2.getState().getNature();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<DreamRadarState> &state) { return state.getState().getNature(); });
             break;
         case 5:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<DreamRadarState> &state1, const SearcherState5<DreamRadarState> &state2) {
-                          return flag ? state1.getState().getAbility() < state2.getState().getAbility()
-                                      : state1.getState().getAbility() > state2.getState().getAbility();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<DreamRadarState> &state) { return state.getState().getAbility(); });
             break;
         case 6:
         case 7:
@@ -230,50 +190,29 @@ void DreamRadarSearcherModel5::sort(int column, Qt::SortOrder order)
         case 9:
         case 10:
         case 11:
-            std::sort(model.begin(), model.end(),
-                      [flag, column](const SearcherState5<DreamRadarState> &state1, const SearcherState5<DreamRadarState> &state2) {
-                          return flag ? state1.getState().getIV(column - 6) < state2.getState().getIV(column - 6)
-                                      : state1.getState().getIV(column - 6) > state2.getState().getIV(column - 6);
-                      });
+            RadixSort::sortBy(model, flag, [column](const SearcherState5<DreamRadarState> &state) {
+                return state.getState().getIV(column - 6);
+            });
             break;
         case 12:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<DreamRadarState> &state1, const SearcherState5<DreamRadarState> &state2) {
-                          return flag ? state1.getState().getHiddenPower() < state2.getState().getHiddenPower()
-                                      : state1.getState().getHiddenPower() > state2.getState().getHiddenPower();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<DreamRadarState> &state) { return state.getState().getHiddenPower(); });
             break;
         case 13:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<DreamRadarState> &state1, const SearcherState5<DreamRadarState> &state2) {
-                          return flag ? state1.getState().getHiddenPowerStrength() < state2.getState().getHiddenPowerStrength()
-                                      : state1.getState().getHiddenPowerStrength() > state2.getState().getHiddenPowerStrength();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<DreamRadarState> &state) {
+                return state.getState().getHiddenPowerStrength();
+            });
             break;
         case 14:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<DreamRadarState> &state1, const SearcherState5<DreamRadarState> &state2) {
-                          return flag ? state1.getState().getGender() < state2.getState().getGender()
-                                      : state1.getState().getGender() > state2.getState().getGender();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<DreamRadarState> &state) { return state.getState().getGender(); });
             break;
         case 15:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<DreamRadarState> &state1, const SearcherState5<DreamRadarState> &state2) {
-                          return flag ? state1.getDateTime() < state2.getDateTime() : state1.getDateTime() > state2.getDateTime();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<DreamRadarState> &state) { return state.getDateTime(); });
             break;
         case 16:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<DreamRadarState> &state1, const SearcherState5<DreamRadarState> &state2) {
-                          return flag ? state1.getTimer0() < state2.getTimer0() : state1.getTimer0() > state2.getTimer0();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<DreamRadarState> &state) { return state.getTimer0(); });
             break;
         case 17:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<DreamRadarState> &state1, const SearcherState5<DreamRadarState> &state2) {
-                          return flag ? state1.getButtons() < state2.getButtons() : state1.getButtons() > state2.getButtons();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<DreamRadarState> &state) { return state.getButtons(); });
             break;
         }
     }
@@ -18,8 +18,9 @@
  */
 
 #include "EventModel5.hpp"
+#include <Core/Util/RadixSort.hpp>
 #include <Core/Util/Translator.hpp>
-#include <Core/Util/Utilities.hpp>
+#include <Model/CellCache.hpp>
 
 EventGeneratorModel5::EventGeneratorModel5(QObject *parent) : TableModel(parent), showStats(false)
 {
@@ -41,27 +42,18 @@ QVariant EventGeneratorModel5::data(const QModelIndex &index, int role) const
         case 0:
             return state.getAdvances();
         case 1:
-            return QString::fromStdString(Utilities5::getChatot(state.getChatot()));
+            return CellCache::chatot(state.getChatot());
         case 2:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 3:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 4:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 5:
-            if (state.getAbility() == 0 || state.getAbility() == 1)
-            {
-                return QString("%1: %2")
-                    .arg(state.getAbility())
-                    .arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
-            else
-            {
-                return QString("H (%2)").arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 6:
         case 7:
         case 8:
@@ -70,13 +62,13 @@ QVariant EventGeneratorModel5::data(const QModelIndex &index, int role) const
         case 11:
             return showStats ? state.getStat(column - 6) : state.getIV(column - 6);
         case 12:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 13:
             return state.getHiddenPowerStrength();
         case 14:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         case 15:
-            return QString::fromStdString(Translator::getCharacteristic(state.getCharacteristic()));
+            return CellCache::characteristic(state.getCharacteristic());
         }
     }
 
@@ -117,29 +109,20 @@ QVariant EventSearcherModel5::data(const QModelIndex &index, int role) const
         switch (column)
         {
         case 0:
-            return QString::number(display.getInitialSeed(), 16).toUpper().rightJustified(16, '0');
+            return CellCache::hex(display.getInitialSeed(), 16);
         case 1:
             return state.getAdvances();
         case 2:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 3:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 4:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 5:
-            if (state.getAbility() == 0 || state.getAbility() == 1)
-            {
-                return QString("%1: %2")
-                    .arg(state.getAbility())
-                    .arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
-            else
-            {
-                return QString("H (%2)").arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 6:
         case 7:
         case 8:
@@ -148,11 +131,11 @@ QVariant EventSearcherModel5::data(const QModelIndex &index, int role) const
         case 11:
             return showStats ? state.getStat(column - 6) : state.getIV(column - 6);
         case 12:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 13:
             return state.getHiddenPowerStrength();
         case 14:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         case 15:
             return QString::fromStdString(display.getDateTime().toString());
         case 16:
@@ -183,39 +166,22 @@ void EventSearcherModel5::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State5> &state1, const SearcherState5<State5> &state2) {
-                return flag ? state1.getInitialSeed() < state2.getInitialSeed() : state1.getInitialSeed() > state2.getInitialSeed();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<State5> &state) { return state.getInitialSeed(); });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State5> &state1, const SearcherState5<State5> &state2) {
-                return flag ? state1.getState().getAdvances() < state2.getState().getAdvances()
-                            : state1.getState().getAdvances() > state2.getState().getAdvances();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<State5> &state) { return state.getState().getAdvances(); });
             break;
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State5> &state1, const SearcherState5<State5> &state2) {
-                return flag ? state1.getState().getPID() < state2.getState().getPID()
-                            : state1.getState().getPID() > state2.getState().getPID();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<State5> &state) { return state.getState().getPID(); });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State5> &state1, const SearcherState5<State5> &state2) {
-                return flag ? state1.getState().getShiny() < state2.getState().getShiny()
-                            : state1.getState().getShiny() > state2.getState().getShiny();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<State5> &state) { return state.getState().getShiny(); });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State5> &state1, const SearcherState5<State5> &state2) {
-                return flag ? state1.getState().getNature() < state2.getState().getNature()
-                            : state1.getState().getNature() > state2.getState().getNature();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<State5> &state) { return state.getState().getNature(); });
             break;
         case 5:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State5> &state1, const SearcherState5<State5> &state2) {
-                return flag ? state1.getState().getAbility() < state2.getState().getAbility()
-                            : state1.getState().getAbility() > state2.getState().getAbility();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<State5> &state) { return state.getState().getAbility(); });
             break;
         case 6:
         case 7:
@@ -223,44 +189,25 @@ void EventSearcherModel5::sort(int column, Qt::SortOrder order)
         case 9:
         case 10:
         case 11:
-            std::sort(model.begin(), model.end(),
-                      [flag, column](const SearcherState5<State5> &state1, const SearcherState5<State5> &state2) {
-                          return flag ? state1.getState().getIV(column - 6) < state2.getState().getIV(column - 6)
-                                      : state1.getState().getIV(column - 6) > state2.getState().getIV(column - 6);
-                      });
+            RadixSort::sortBy(model, flag, [column](const SearcherState5<State5> &state) { return state.getState().getIV(column - 6); });
             break;
         case 12:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State5> &state1, const SearcherState5<State5> &state2) {
-                return flag ? state1.getState().getHiddenPower() < state2.getState().getHiddenPower()
-                            : state1.getState().getHiddenPower() > state2.getState().getHiddenPower();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<State5> &state) { return state.getState().getHiddenPower(); });
             break;
         case 13:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State5> &state1, const SearcherState5<State5> &state2) {
-                return flag ? state1.getState().getHiddenPowerStrength() < state2.getState().getHiddenPowerStrength()
-                            : state1.getState().getHiddenPowerStrength() > state2.getState().getHiddenPowerStrength();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<State5> &state) { return state.getState().getHiddenPowerStrength(); });
             break;
         case 14:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State5> &state1, const SearcherState5<State5> &state2) {
-                return flag ? state1.getState().getGender() < state2.getState().getGender()
-                            : state1.getState().getGender() > state2.getState().getGender();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<State5> &state) { return state.getState().getGender(); });
             break;
         case 15:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State5> &state1, const SearcherState5<State5> &state2) {
-                return flag ? state1.getDateTime() < state2.getDateTime() : state1.getDateTime() > state2.getDateTime();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<State5> &state) { return state.getDateTime(); });
             break;
         case 16:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State5> &state1, const SearcherState5<State5> &state2) {
-                return flag ? state1.getTimer0() < state2.getTimer0() : state1.getTimer0() > state2.getTimer0();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<State5> &state) { return state.getTimer0(); });
             break;
         case 17:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State5> &state1, const SearcherState5<State5> &state2) {
-                return flag ? state1.getButtons() < state2.getButtons() : state1.getButtons() > state2.getButtons();
-            });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<State5> &state) { return state.getButtons(); });
             break;
         }
     }
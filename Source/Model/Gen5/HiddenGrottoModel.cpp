@@ -18,8 +18,9 @@
  */
 
 #include "HiddenGrottoModel.hpp"
+#include <Core/Util/RadixSort.hpp>
 #include <Core/Util/Translator.hpp>
-#include <Core/Util/Utilities.hpp>
+#include <Model/CellCache.hpp>
 
 HiddenGrottoGeneratorModel5::HiddenGrottoGeneratorModel5(QObject *parent) : TableModel(parent)
 {
@@ -41,20 +42,19 @@ QVariant HiddenGrottoGeneratorModel5::data(const QModelIndex &index, int role) c
         case 0:
             return state.getAdvances();
         case 1:
-            return QString::fromStdString(Utilities5::getChatot(state.getChatot()));
+            return CellCache::chatot(state.getChatot());
         case 2:
             return state.getGroup();
         case 3:
             if (state.getItem())
             {
-                return QString("%1: %2").arg(state.getSlot()).arg(QString::fromStdString(Translator::getItem(state.getData())));
+                return QString("%1: %2").arg(state.getSlot()).arg(CellCache::item(state.getData()));
             }
             else
             {
                 return QString("%1 (%2 %3)")
                     .arg(state.getSlot())
-                    .arg(QString::fromStdString(Translator::getSpecie(state.getData())),
-                         QString::fromStdString(Translator::getGender(state.getGender())));
+                    .arg(CellCache::specie(state.getData()), CellCache::gender(state.getGender()));
             }
         }
     }
@@ -89,7 +89,7 @@ QVariant HiddenGrottoSearcherModel5::data(const QModelIndex &index, int role) co
         switch (column)
         {
         case 0:
-            return QString::number(display.getInitialSeed(), 16).toUpper().rightJustified(16, '0');
+            return CellCache::hex(display.getInitialSeed(), 16);
         case 1:
             return state.getAdvances();
         case 2:
@@ -97,14 +97,13 @@ QVariant HiddenGrottoSearcherModel5::data(const QModelIndex &index, int role) co
         case 3:
             if (state.getItem())
             {
-                return QString("%1: %2").arg(state.getSlot()).arg(QString::fromStdString(Translator::getItem(state.getData())));
+                return QString("%1: %2").arg(state.getSlot()).arg(CellCache::item(state.getData()));
             }
             else
             {
                 return QString("%1 (%2 %3)")
                     .arg(state.getSlot())
-                    .arg(QString::fromStdString(Translator::getSpecie(state.getData())),
-                         QString::fromStdString(Translator::getGender(state.getGender())));
+                    .arg(CellCache::specie(state.getData()), CellCache::gender(state.getGender()));
             }
         case 4:
             return QString::fromStdString(display.getDateTime().toString());
@@ -135,50 +134,25 @@ void HiddenGrottoSearcherModel5::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2) {
-                          return flag ? state1.getInitialSeed() < state2.getInitialSeed()
-                                      : state1.getInitialSeed() > state2.getInitialSeed();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<HiddenGrottoState> &state) { return state.getInitialSeed(); });
             break;
         case 1:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2) {
-                          return flag ? state1.getState().getAdvances() < state2.getState().getAdvances()
-                                      : state1.getState().getAdvances() > state2.getState().getAdvances();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<HiddenGrottoState> &state) { return state.getState().getAdvances(); });
             break;
         case 2:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2) {
-                          return flag ? state1.getState().getGroup() < state2.getState().getGroup()
-                                      : state1.getState().getGroup() > state2.getState().getGroup();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<HiddenGrottoState> &state) { return state.getState().getGroup(); });
             break;
         case 3:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2) {
-                          return flag ? state1.getState().getSlot() < state2.getState().getSlot()
-                                      : state1.getState().getSlot() > state2.getState().getSlot();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<HiddenGrottoState> &state) { return state.getState().getSlot(); });
             break;
         case 4:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2) {
-                          return flag ? state1.getDateTime() < state2.getDateTime() : state1.getDateTime() > state2.getDateTime();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<HiddenGrottoState> &state) { return state.getDateTime(); });
             break;
         case 5:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2) {
-                          return flag ? state1.getTimer0() < state2.getTimer0() : state1.getTimer0() > state2.getTimer0();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<HiddenGrottoState> &state) { return state.getTimer0(); });
             break;
         case 6:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2) {
-                          return flag ? state1.getButtons() < state2.getButtons() : state1.getButtons() > state2.getButtons();
-                      });
+            RadixSort::sortBy(model, flag, [](const SearcherState5<HiddenGrottoState> &state) { return state.getButtons(); });
             break;
         }
     }
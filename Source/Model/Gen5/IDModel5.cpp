@@ -21,6 +21,7 @@
 #include <Core/Enum/Game.hpp>
 #include <Core/Util/Translator.hpp>
 #include <Core/Util/Utilities.hpp>
+#include <Model/CellCache.hpp>
 
 IDModel5::IDModel5(QObject *parent) : TableModel(parent), version(Game::Black)
 {
@@ -40,7 +41,7 @@ QVariant IDModel5::data(const QModelIndex &index, int role) const
         switch (index.column())
         {
         case 0:
-            return QString::number(display.getInitialSeed(), 16).toUpper().rightJustified(16, '0');
+            return CellCache::hex(display.getInitialSeed(), 16);
         case 1:
             return Utilities5::initialAdvancesID(display.getInitialSeed(), version);
         case 2:
@@ -18,7 +18,7 @@
  */
 
 #include "EggModel8.hpp"
-#include <Core/Util/Translator.hpp>
+#include <Model/CellCache.hpp>
 
 EggModel8::EggModel8(QObject *parent) : TableModel(parent), showInheritance(false), showStats(false)
 {
@@ -40,29 +40,20 @@ QVariant EggModel8::data(const QModelIndex &index, int role) const
         case 0:
             return state.getAdvances();
         case 1:
-            return QString::number(state.getSeed(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getSeed(), 8);
         case 2:
-            return QString::number(state.getEC(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getEC(), 8);
         case 3:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 4:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 5:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 6:
-            if (state.getAbility() == 0 || state.getAbility() == 1)
-            {
-                return QString("%1: %2")
-                    .arg(state.getAbility())
-                    .arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
-            else
-            {
-                return QString("H (%2)").arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 7:
         case 8:
         case 9:
@@ -79,9 +70,9 @@ QVariant EggModel8::data(const QModelIndex &index, int role) const
             }
             return showStats ? state.getStat(column - 7) : state.getIV(column - 7);
         case 13:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         case 14:
-            return QString::fromStdString(Translator::getCharacteristic(state.getCharacteristic()));
+            return CellCache::characteristic(state.getCharacteristic());
         }
     }
 
@@ -18,7 +18,7 @@
  */
 
 #include "RaidModel.hpp"
-#include <Core/Util/Translator.hpp>
+#include <Model/CellCache.hpp>
 
 RaidModel::RaidModel(QObject *parent) : TableModel(parent), showStats(false)
 {
@@ -49,18 +49,9 @@ QVariant RaidModel::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 4:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 5:
-            if (state.getAbility() == 0 || state.getAbility() == 1)
-            {
-                return QString("%1: %2")
-                    .arg(state.getAbility())
-                    .arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
-            else
-            {
-                return QString("H (%2)").arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 6:
         case 7:
         case 8:
@@ -69,13 +60,13 @@ QVariant RaidModel::data(const QModelIndex &index, int role) const
         case 11:
             return showStats ? state.getStat(column - 6) : state.getIV(column - 6);
         case 12:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         case 13:
             return state.getHeight();
         case 14:
             return state.getWeight();
         case 15:
-            return QString::fromStdString(Translator::getCharacteristic(state.getCharacteristic()));
+            return CellCache::characteristic(state.getCharacteristic());
         }
     }
     return QVariant();
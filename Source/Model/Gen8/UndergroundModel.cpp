@@ -20,6 +20,7 @@
 
 #include "UndergroundModel.hpp"
 #include <Core/Util/Translator.hpp>
+#include <Model/CellCache.hpp>
 
 UndergroundModel::UndergroundModel(QObject *parent) : TableModel(parent), showStats(false)
 {
@@ -43,33 +44,24 @@ QVariant UndergroundModel::data(const QModelIndex &index, int role) const
         case 1:
             return QString::fromStdString(Translator::getMove(state.getEggMove()));
         case 2:
-            return QString::fromStdString(Translator::getItem(state.getItem()));
+            return CellCache::item(state.getItem());
         case 3:
-            return QString::fromStdString(Translator::getSpecie(state.getSpecie()));
+            return CellCache::specie(state.getSpecie());
         case 4:
             return state.getLevel();
         case 5:
-            return QString::number(state.getEC(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getEC(), 8);
         case 6:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 7:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 8:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 9:
-            if (state.getAbility() == 0 || state.getAbility() == 1)
-            {
-                return QString("%1: %2")
-                    .arg(state.getAbility())
-                    .arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
-            else
-            {
-                return QString("H (%2)").arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 10:
         case 11:
         case 12:
@@ -78,9 +70,9 @@ QVariant UndergroundModel::data(const QModelIndex &index, int role) const
         case 15:
             return showStats ? state.getStat(column - 10) : state.getIV(column - 10);
         case 16:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         case 17:
-            return QString::fromStdString(Translator::getCharacteristic(state.getCharacteristic()));
+            return CellCache::characteristic(state.getCharacteristic());
         }
     }
 
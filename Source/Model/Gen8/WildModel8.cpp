@@ -18,7 +18,7 @@
  */
 
 #include "WildModel8.hpp"
-#include <Core/Util/Translator.hpp>
+#include <Model/CellCache.hpp>
 
 WildModel8::WildModel8(QObject *parent) : TableModel(parent), showStats(false)
 {
@@ -40,35 +40,24 @@ QVariant WildModel8::data(const QModelIndex &index, int role) const
         case 0:
             return state.getAdvances();
         case 1:
-            return QString::fromStdString(Translator::getItem(state.getItem()));
+            return CellCache::item(state.getItem());
         case 2:
-            return QString("%1: %2")
-                .arg(state.getEncounterSlot())
-                .arg(QString::fromStdString(Translator::getSpecie(state.getSpecie(), state.getForm())));
+            return QString("%1: %2").arg(state.getEncounterSlot()).arg(CellCache::specie(state.getSpecie(), state.getForm()));
         case 3:
             return state.getLevel();
         case 4:
-            return QString::number(state.getEC(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getEC(), 8);
         case 5:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 6:
         {
             u8 shiny = state.getShiny();
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 7:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return CellCache::nature(state.getNature());
         case 8:
-            if (state.getAbility() == 0 || state.getAbility() == 1)
-            {
-                return QString("%1: %2")
-                    .arg(state.getAbility())
-                    .arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
-            else
-            {
-                return QString("H (%2)").arg(QString::fromStdString(Translator::getAbility(state.getAbilityIndex())));
-            }
+            return CellCache::ability(state.getAbility(), state.getAbilityIndex());
         case 9:
         case 10:
         case 11:
@@ -77,15 +66,15 @@ QVariant WildModel8::data(const QModelIndex &index, int role) const
         case 14:
             return showStats ? state.getStat(column - 9) : state.getIV(column - 9);
         case 15:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHiddenPower()));
+            return CellCache::hiddenPower(state.getHiddenPower());
         case 16:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return CellCache::gender(state.getGender());
         case 17:
             return state.getHeight();
         case 18:
             return state.getWeight();
         case 19:
-            return QString::fromStdString(Translator::getCharacteristic(state.getCharacteristic()));
+            return CellCache::characteristic(state.getCharacteristic());
         }
     }
 
@@ -19,6 +19,7 @@
 
 #include "IVToPIDModel.hpp"
 #include <Core/Enum/Method.hpp>
+#include <Model/CellCache.hpp>
 
 IVToPIDModel::IVToPIDModel(QObject *parent) : TableModel(parent)
 {
@@ -38,9 +39,9 @@ QVariant IVToPIDModel::data(const QModelIndex &index, int role) const
         switch (column)
         {
         case 0:
-            return QString::number(state.getSeed(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getSeed(), 8);
         case 1:
-            return QString::number(state.getPID(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPID(), 8);
         case 2:
             switch (state.getMethod())
             {
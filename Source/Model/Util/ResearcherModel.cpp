@@ -18,6 +18,7 @@
  */
 
 #include "ResearcherModel.hpp"
+#include <Model/CellCache.hpp>
 
 ResearcherModel::ResearcherModel(QObject *parent, bool flag) : TableModel(parent), flag(flag)
 {
@@ -50,17 +51,17 @@ QVariant ResearcherModel::data(const QModelIndex &index, int role) const
         case 0:
             return state.getAdvances();
         case 1:
-            return QString::number(state.getPRNG(), 16).toUpper().rightJustified(16, '0');
+            return CellCache::hex(state.getPRNG(), 16);
         case 2:
-            return QString::number(state.getHigh32(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getHigh32(), 8);
         case 3:
-            return QString::number(state.getLow32(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getLow32(), 8);
         case 4:
-            return QString::number(state.getPRNG(), 16).toUpper().rightJustified(8, '0');
+            return CellCache::hex(state.getPRNG(), 8);
         case 5:
-            return QString::number(state.getHigh16(), 16).toUpper().rightJustified(4, '0');
+            return CellCache::hex(state.getHigh16(), 4);
         case 6:
-            return QString::number(state.getLow16(), 16).toUpper().rightJustified(4, '0');
+            return CellCache::hex(state.getLow16(), 4);
         case 7:
         case 8:
         case 9:
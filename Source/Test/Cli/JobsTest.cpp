@@ -0,0 +1,191 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "JobsTest.hpp"
+#include <Cli/Jobs.hpp>
+#include <Cli/ResultWriter.hpp>
+#include <Core/Enum/Game.hpp>
+#include <Core/Enum/Lead.hpp>
+#include <Core/Gen4/Encounters4.hpp>
+#include <Core/Gen4/Generators/StaticGenerator4.hpp>
+#include <Core/Gen4/Profile4.hpp>
+#include <Core/Gen4/Searchers/IDSearcher4.hpp>
+#include <Core/Gen4/States/IDState4.hpp>
+#include <Core/Gen4/States/State4.hpp>
+#include <Core/Gen4/StaticTemplate4.hpp>
+#include <Core/Parents/Filters/IDFilter.hpp>
+#include <Core/Parents/Filters/StateFilter.hpp>
+#include <QTest>
+#include <Test/Data.hpp>
+#include <algorithm>
+#include <sstream>
+
+/**
+ * @brief Runs a job and parses its NDJSON output
+ *
+ * @param job Job specification
+ * @param threads Number of threads to search with
+ *
+ * @return Output rows
+ */
+static std::vector<json> runJob(const json &job, int threads)
+{
+    std::stringstream stream;
+    ResultWriter writer(stream, OutputFormat::NDJSON);
+    Jobs::run(job, threads, writer);
+
+    std::vector<json> rows;
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        rows.emplace_back(json::parse(line));
+    }
+    return rows;
+}
+
+void JobsTest::getTypes()
+{
+    json data = readData("jobs", "getTypes");
+    QVERIFY(Jobs::getTypes() == data.get<std::vector<std::string>>());
+}
+
+void JobsTest::invalidJob_data()
+{
+    QTest::addColumn<std::string>("job");
+
+    json data = readData("jobs", "invalidJob");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["job"].dump();
+    }
+}
+
+void JobsTest::invalidJob()
+{
+    QFETCH(std::string, job);
+
+    std::stringstream stream;
+    ResultWriter writer(stream, OutputFormat::NDJSON);
+
+    bool rejected = false;
+    try
+    {
+        Jobs::run(json::parse(job), 1, writer);
+    }
+    catch (const std::exception &)
+    {
+        rejected = true;
+    }
+    QVERIFY(rejected);
+    QVERIFY(writer.getCount() == 0);
+}
+
+void JobsTest::runID4_data()
+{
+    QTest::addColumn<std::string>("job");
+    QTest::addColumn<int>("threads");
+
+    json data = readData("jobs", "runID4");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["job"].dump() << d["threads"].get<int>();
+    }
+}
+
+void JobsTest::runID4()
+{
+    QFETCH(std::string, job);
+    QFETCH(int, threads);
+
+    json j = json::parse(job);
+    auto rows = runJob(j, threads);
+
+    // The job splits the delays between its threads, so it has to match one searcher over the whole range
+    IDFilter filter(j["tid"].get<std::vector<u16>>(), {}, {}, {});
+    IDSearcher4 searcher(filter);
+    searcher.startSearch(false, j["year"].get<u16>(), j["minDelay"].get<u32>(), j["maxDelay"].get<u32>());
+    auto states = searcher.getResults();
+
+    auto compare = [](const auto &left, const auto &right) { return left.first < right.first; };
+    std::vector<std::pair<u32, u32>> expected;
+    for (const auto &state : states)
+    {
+        expected.emplace_back(state.getSeed(), state.getDelay());
+        QCOMPARE(state.getTID(), j["tid"][0].get<u16>());
+    }
+    std::sort(expected.begin(), expected.end(), compare);
+
+    std::vector<std::pair<u32, u32>> results;
+    for (const auto &row : rows)
+    {
+        results.emplace_back(row["seed"].get<u32>(), row["delay"].get<u32>());
+    }
+    std::sort(results.begin(), results.end(), compare);
+
+    QVERIFY(!expected.empty());
+    QVERIFY(results == expected);
+}
+
+void JobsTest::runStatic4Generator_data()
+{
+    QTest::addColumn<std::string>("job");
+
+    json data = readData("jobs", "runStatic4Generator");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["job"].dump();
+    }
+}
+
+void JobsTest::runStatic4Generator()
+{
+    QFETCH(std::string, job);
+
+    json j = json::parse(job);
+    auto rows = runJob(j, 1);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    Profile4 profile("-", Game::Platinum, j["profile"]["tid"].get<u16>(), j["profile"]["sid"].get<u16>(), false);
+    StateFilter filter(255, 255, 255, false, { 0, 0, 0, 0, 0, 0 }, { 31, 31, 31, 31, 31, 31 }, natures, powers);
+    const StaticTemplate4 *staticTemplate = Encounters4::getStaticEncounter(j["category"].get<int>(), j["index"].get<int>());
+    StaticGenerator4 generator(0, j["maxAdvances"].get<u32>(), 0, staticTemplate->getMethod(), Lead::None, *staticTemplate, profile,
+                               filter);
+    auto states = generator.generate(j["seed"].get<u32>());
+
+    QCOMPARE(rows.size(), states.size());
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        QCOMPARE(rows[i]["advances"].get<u32>(), states[i].getAdvances());
+        QCOMPARE(rows[i]["pid"].get<u32>(), states[i].getPID());
+        auto ivs = rows[i]["ivs"].get<std::array<u8, 6>>();
+        QVERIFY(ivs == states[i].getIVs());
+    }
+}
+
+void JobsTest::unknownType()
+{
+    std::stringstream stream;
+    ResultWriter writer(stream, OutputFormat::NDJSON);
+    QVERIFY(!Jobs::run(json { { "type", "unknown" } }, 1, writer));
+}
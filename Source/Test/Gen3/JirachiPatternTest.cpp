@@ -49,6 +49,35 @@ void JirachiPatternTest::calculateActions()
     QCOMPARE(JirachiPattern::calculateActions(seed, targetAdvance, bruteForce), results);
 }
 
+void JirachiPatternTest::calculateActionPlans_data()
+{
+    QTest::addColumn<u32>("seed");
+    QTest::addColumn<u32>("target");
+    QTest::addColumn<u32>("bruteForce");
+    QTest::addColumn<u32>("maxPlans");
+    QTest::addColumn<std::vector<std::vector<u8>>>("results");
+
+    json data = readData("jirachipattern", "calculateActionPlans");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["seed"].get<u32>() << d["target"].get<u32>() << d["bruteForce"].get<u32>() << d["maxPlans"].get<u32>()
+            << d["results"].get<std::vector<std::vector<u8>>>();
+    }
+}
+
+void JirachiPatternTest::calculateActionPlans()
+{
+    QFETCH(u32, seed);
+    QFETCH(u32, target);
+    QFETCH(u32, bruteForce);
+    QFETCH(u32, maxPlans);
+    QFETCH(std::vector<std::vector<u8>>, results);
+
+    u32 targetAdvance = XDRNG::distance(seed, target);
+    QCOMPARE(JirachiPattern::calculateActionPlans(seed, targetAdvance, bruteForce, maxPlans), results);
+}
+
 void JirachiPatternTest::computeJirachiSeed_data()
 {
     QTest::addColumn<u32>("seed");
@@ -29,6 +29,9 @@ private slots:
     void calculateActions_data();
     void calculateActions();
 
+    void calculateActionPlans_data();
+    void calculateActionPlans();
+
     void computeJirachiSeed_data();
     void computeJirachiSeed();
 };
@@ -115,3 +115,84 @@ void WildSearcher3Test::search()
         QVERIFY(state == generatorStates[0]);
     }
 }
+
+void WildSearcher3Test::searchLeads_data()
+{
+    QTest::addColumn<IVs>("min");
+    QTest::addColumn<IVs>("max");
+    QTest::addColumn<Game>("version");
+    QTest::addColumn<Method>("method");
+    QTest::addColumn<Encounter>("encounter");
+    QTest::addColumn<std::vector<Lead>>("leads");
+    QTest::addColumn<bool>("feebasTile");
+    QTest::addColumn<int>("location");
+
+    json data = readData("wild3", "wildsearcher3", "searchLeads");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["min"].get<IVs>() << d["max"].get<IVs>() << d["version"].get<Game>() << d["method"].get<Method>()
+            << d["encounter"].get<Encounter>() << d["leads"].get<std::vector<Lead>>() << d.value("feebasTile", false)
+            << d["location"].get<int>();
+    }
+}
+
+void WildSearcher3Test::searchLeads()
+{
+    QFETCH(IVs, min);
+    QFETCH(IVs, max);
+    QFETCH(Game, version);
+    QFETCH(Method, method);
+    QFETCH(Encounter, encounter);
+    QFETCH(std::vector<Lead>, leads);
+    QFETCH(bool, feebasTile);
+    QFETCH(int, location);
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    std::array<bool, 12> encounterSlots;
+    encounterSlots.fill(true);
+
+    Profile3 profile("-", version, 12345, 54321, false);
+
+    EncounterSettings3 settings;
+    settings.feebasTile = feebasTile;
+
+    std::vector<EncounterArea3> encounterAreas = Encounters3::getEncounters(encounter, settings, version);
+    auto encounterArea = std::find_if(encounterAreas.begin(), encounterAreas.end(),
+                                      [location](const EncounterArea3 &encounterArea) { return encounterArea.getLocation() == location; });
+
+    WildStateFilter filter(255, 255, 255, false, min, max, natures, powers, encounterSlots);
+    WildSearcher3 searcher(method, leads, settings.feebasTile, *encounterArea, profile, filter);
+
+    searcher.startSearch(min, max);
+    auto states = searcher.getResults();
+
+    // Ensure every lead finds the same states as searching the lead by itself
+    size_t total = 0;
+    for (Lead lead : leads)
+    {
+        WildSearcher3 leadSearcher(method, lead, settings.feebasTile, *encounterArea, profile, filter);
+        leadSearcher.startSearch(min, max);
+        auto leadStates = leadSearcher.getResults();
+
+        std::vector<WildSearcherState> matches;
+        std::copy_if(states.begin(), states.end(), std::back_inserter(matches),
+                     [lead](const WildSearcherState &state) { return state.getLead() == lead; });
+
+        QCOMPARE(matches.size(), leadStates.size());
+        for (size_t i = 0; i < matches.size(); i++)
+        {
+            QCOMPARE(matches[i].getSeed(), leadStates[i].getSeed());
+            QCOMPARE(matches[i].getEncounterSlot(), leadStates[i].getEncounterSlot());
+            QCOMPARE(matches[i].getLevel(), leadStates[i].getLevel());
+        }
+        total += leadStates.size();
+    }
+    QCOMPARE(states.size(), total);
+}
+
@@ -28,6 +28,9 @@ class WildSearcher3Test : public QObject
 private slots:
     void search_data();
     void search();
+
+    void searchLeads_data();
+    void searchLeads();
 };
 
 #endif // WILDSEARCHER3TEST_HPP
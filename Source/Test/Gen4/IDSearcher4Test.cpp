@@ -20,8 +20,16 @@
 #include "IDSearcher4Test.hpp"
 #include <Core/Gen4/Searchers/IDSearcher4.hpp>
 #include <Core/Gen4/States/IDState4.hpp>
+#include <QTemporaryDir>
 #include <QTest>
 #include <Test/Data.hpp>
+#include <thread>
+
+static bool operator==(const IDState4 &left, const IDState4 &right)
+{
+    return left.getSID() == right.getSID() && left.getTID() == right.getTID() && left.getTSV() == right.getTSV()
+        && left.getDelay() == right.getDelay() && left.getSeed() == right.getSeed();
+}
 
 static bool operator==(const IDState4 &left, const json &right)
 {
@@ -68,3 +76,66 @@ void IDSearcher4Test::search()
         QVERIFY(state == j[i]);
     }
 }
+
+void IDSearcher4Test::checkpointKey()
+{
+    QTemporaryDir dir;
+    std::string path = dir.filePath("id4.checkpoint").toStdString();
+
+    IDSearcher4 first(IDFilter({ 12345 }, {}, {}, {}));
+    first.setCheckpoint(path, 1);
+    first.startSearch(false, 2000, 5000, 5255);
+
+    // A checkpoint saved for different filter settings must not be resumed
+    IDFilter filter({ 54321 }, {}, {}, {});
+    IDSearcher4 expected(filter);
+    expected.startSearch(false, 2000, 5000, 5255);
+    auto states = expected.getResults();
+
+    IDSearcher4 second(filter);
+    second.setCheckpoint(path, 2);
+    second.startSearch(false, 2000, 5000, 5255);
+    auto resumed = second.getResults();
+
+    QVERIFY(!states.empty());
+    QCOMPARE(resumed.size(), states.size());
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        QVERIFY(resumed[i] == states[i]);
+    }
+}
+
+void IDSearcher4Test::resume()
+{
+    QTemporaryDir dir;
+    std::string path = dir.filePath("id4.checkpoint").toStdString();
+
+    IDFilter filter({ 12345, 54321 }, {}, {}, {});
+
+    IDSearcher4 full(filter);
+    full.startSearch(false, 2000, 5000, 6023);
+    auto states = full.getResults();
+
+    // Cancel once a few work units have been saved
+    IDSearcher4 interrupted(filter);
+    interrupted.setCheckpoint(path, 1, 1);
+    std::thread thread([&interrupted] { interrupted.startSearch(false, 2000, 5000, 6023); });
+    while (interrupted.getProgress() < 2 * 256 * 256 * 24)
+    {
+        std::this_thread::yield();
+    }
+    interrupted.cancelSearch();
+    thread.join();
+    QVERIFY(interrupted.getResults().size() < states.size());
+
+    IDSearcher4 resumed(filter);
+    resumed.setCheckpoint(path, 1, 1);
+    resumed.startSearch(false, 2000, 5000, 6023);
+    auto results = resumed.getResults();
+
+    QCOMPARE(results.size(), states.size());
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        QVERIFY(results[i] == states[i]);
+    }
+}
@@ -28,6 +28,10 @@ class IDSearcher4Test : public QObject
 private slots:
     void search_data();
     void search();
+
+    void checkpointKey();
+
+    void resume();
 };
 
 #endif // IDSEARCHER4TEST_HPP
@@ -119,6 +119,8 @@ void WildSearcher4Test::searchMethodJ()
 
     for (const auto &state : states)
     {
+        QVERIFY(state.getLead() == lead);
+
         // Ensure generator agrees
         WildGenerator4 generator(state.getAdvances(), 0, 0, Method::MethodJ, lead != Lead::Synchronize ? lead : lead + state.getNature(),
                                  settings.dppt.feebasTile, false, false, 50, *encounterArea, profile, filter);
@@ -199,6 +201,8 @@ void WildSearcher4Test::searchMethodK()
 
     for (const auto &state : states)
     {
+        QVERIFY(state.getLead() == lead);
+
         // Ensure generator agrees
         WildGenerator4 generator(state.getAdvances(), 0, 0, Method::MethodK, lead != Lead::Synchronize ? lead : lead + state.getNature(),
                                  false, false, false, 50, *encounterArea, profile, filter);
@@ -280,6 +284,8 @@ void WildSearcher4Test::searchPokeRadar()
 
     for (const auto &state : states)
     {
+        QVERIFY(state.getLead() == lead);
+
         // Ensure generator agrees
         WildGenerator4 generator(state.getAdvances(), 0, 0, Method::PokeRadar, lead != Lead::Synchronize ? lead : lead + state.getNature(),
                                  false, shiny, false, 50, *encounterArea, profile, filter);
@@ -0,0 +1,159 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Searcher5Test.hpp"
+#include <Core/Enum/DSType.hpp>
+#include <Core/Enum/Game.hpp>
+#include <Core/Enum/Language.hpp>
+#include <Core/Gen5/Generators/EventGenerator5.hpp>
+#include <Core/Gen5/PGF.hpp>
+#include <Core/Gen5/Profile5.hpp>
+#include <Core/Gen5/Searchers/Searcher5.hpp>
+#include <Core/Gen5/States/SearcherKey5.hpp>
+#include <Core/Gen5/States/SearcherState5.hpp>
+#include <Core/Gen5/States/State5.hpp>
+#include <QTemporaryDir>
+#include <QTest>
+#include <algorithm>
+#include <thread>
+
+/**
+ * @brief Creates an event generator that keeps roughly one seed in a thousand
+ *
+ * @param profile Profile information
+ *
+ * @return Event generator
+ */
+static EventGenerator5 getGenerator(const Profile5 &profile)
+{
+    std::array<u8, 6> min = { 31, 31, 0, 0, 0, 0 };
+    std::array<u8, 6> max = { 31, 31, 31, 31, 31, 31 };
+
+    std::array<bool, 25> natures;
+    natures.fill(true);
+
+    std::array<bool, 16> powers;
+    powers.fill(true);
+
+    PGF pgf(12345, 54321, 1, 255, 255, 0, 0, 5, 255, 255, 255, 255, 255, 255, false);
+    StateFilter filter(255, 255, 255, false, min, max, natures, powers);
+    return EventGenerator5(0, 0, 0, pgf, profile, filter);
+}
+
+/**
+ * @brief Sorts search results so results of runs with different thread scheduling can be compared
+ *
+ * @param states Search results
+ */
+static void sortStates(std::vector<SearcherState5<State5>> &states)
+{
+    std::sort(states.begin(), states.end(), [](const SearcherState5<State5> &left, const SearcherState5<State5> &right) {
+        return left.getInitialSeed() < right.getInitialSeed();
+    });
+}
+
+void Searcher5Test::reconstruct()
+{
+    Profile5 profile("-", Game::White, 12345, 54321, 0x9bf6d93ce, { true, true, false, false, false, false, false, false, false }, 0x5f,
+                     6, 5, false, 0xc79, 0xc7a, false, false, false, DSType::DS, Language::English);
+    EventGenerator5 generator = getGenerator(profile);
+    Date date(2024, 1, 1);
+
+    Searcher5<EventGenerator5, State5> full(generator, profile);
+    full.startSearch(2, date, date);
+    auto states = full.getResults();
+    sortStates(states);
+
+    Searcher5<EventGenerator5, State5, SearcherKey5> compact(generator, profile);
+    compact.startSearch(2, date, date);
+    auto keys = compact.getResults();
+
+    std::vector<SearcherState5<State5>> results;
+    for (const auto &key : keys)
+    {
+        auto state = compact.reconstruct(key);
+        QVERIFY(state.has_value());
+        results.emplace_back(*state);
+    }
+    sortStates(results);
+
+    QVERIFY(!states.empty());
+    QCOMPARE(results.size(), states.size());
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        QCOMPARE(results[i].getInitialSeed(), states[i].getInitialSeed());
+        QCOMPARE(results[i].getTimer0(), states[i].getTimer0());
+        QVERIFY(results[i].getButtons() == states[i].getButtons());
+        QVERIFY(results[i].getDateTime() == states[i].getDateTime());
+        QCOMPARE(results[i].getState().getAdvances(), states[i].getState().getAdvances());
+        QCOMPARE(results[i].getState().getPID(), states[i].getState().getPID());
+        QVERIFY(results[i].getState().getIVs() == states[i].getState().getIVs());
+    }
+
+    // Keys that do not refer to a key press or state of the searcher are rejected
+    const SearcherKey5 &key = keys.front();
+    QVERIFY(!compact.reconstruct(SearcherKey5(key.getDateTime(), key.getTimer0(), 0xffff, key.getIndex())).has_value());
+    QVERIFY(!compact.reconstruct(SearcherKey5(key.getDateTime(), key.getTimer0(), key.getKeypress(), 1)).has_value());
+}
+
+void Searcher5Test::resume()
+{
+    QTemporaryDir dir;
+    std::string path = dir.filePath("searcher5.checkpoint").toStdString();
+
+    Profile5 profile("-", Game::White, 12345, 54321, 0x9bf6d93ce, { true, false, false, false, false, false, false, false, false }, 0x5f,
+                     6, 5, false, 0xc79, 0xc7a, false, false, false, DSType::DS, Language::English);
+    EventGenerator5 generator = getGenerator(profile);
+    Date start(2024, 1, 1);
+    Date end(2024, 1, 2);
+
+    Searcher5<EventGenerator5, State5> full(generator, profile);
+    full.startSearch(1, start, end);
+    auto states = full.getResults();
+    sortStates(states);
+
+    // Cancel once a few work units have been saved
+    Searcher5<EventGenerator5, State5> interrupted(generator, profile);
+    interrupted.setCheckpoint(path, 1, 1);
+    std::thread thread([&] { interrupted.startSearch(1, start, end); });
+    while (interrupted.getProgress() < 2)
+    {
+        std::this_thread::yield();
+    }
+    interrupted.cancelSearch();
+    thread.join();
+    QVERIFY(interrupted.getResults().size() < states.size());
+
+    Searcher5<EventGenerator5, State5> resumed(generator, profile);
+    resumed.setCheckpoint(path, 1, 1);
+    resumed.startSearch(2, start, end);
+    auto results = resumed.getResults();
+    sortStates(results);
+
+    QVERIFY(!states.empty());
+    QCOMPARE(results.size(), states.size());
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        QCOMPARE(results[i].getInitialSeed(), states[i].getInitialSeed());
+        QCOMPARE(results[i].getTimer0(), states[i].getTimer0());
+        QVERIFY(results[i].getDateTime() == states[i].getDateTime());
+        QCOMPARE(results[i].getState().getPID(), states[i].getState().getPID());
+        QVERIFY(results[i].getState().getIVs() == states[i].getState().getIVs());
+    }
+}
@@ -0,0 +1,270 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SeedCache5Test.hpp"
+#include <Core/Enum/DSType.hpp>
+#include <Core/Enum/Game.hpp>
+#include <Core/Enum/Language.hpp>
+#include <Core/Gen5/Profile5.hpp>
+#include <Core/Gen5/SeedCache5.hpp>
+#include <Core/Util/DateTime.hpp>
+#include <QTemporaryDir>
+#include <QTest>
+#include <algorithm>
+
+// Size of a block file, the magic and key followed by the seeds
+constexpr u64 blockSize = 8 + 11 * sizeof(u64) + SeedCache5::blockSeeds * sizeof(u64);
+
+static const Profile5 profile("-", Game::White, 12345, 54321, 0x9bf6d93ce, { true, false, false, false, false, false, false, false, false },
+                              0x5f, 6, 5, false, 0xc79, 0xc7a, false, false, false, DSType::DS, Language::English);
+static const Date date(2024, 1, 1);
+
+/**
+ * @brief Creates a block of seeds that is unique to \p timer0
+ *
+ * @param timer0 Timer0 value
+ *
+ * @return Vector of seeds
+ */
+static std::vector<u64> getSeeds(u16 timer0)
+{
+    std::vector<u64> seeds(SeedCache5::blockSeeds);
+    for (u32 i = 0; i < seeds.size(); i++)
+    {
+        seeds[i] = (static_cast<u64>(timer0) << 32) | (i * 0x9e3779b9);
+    }
+    return seeds;
+}
+
+/**
+ * @brief Inserts the block of \p timer0 into the cache
+ *
+ * @param timer0 Timer0 value
+ */
+static void insertBlock(u16 timer0)
+{
+    auto seeds = getSeeds(timer0);
+    SeedCache5::insert(profile, timer0, date, 0, seeds.data());
+}
+
+/**
+ * @brief Checks if the block of \p timer0 is cached with the expected seeds
+ *
+ * @param timer0 Timer0 value
+ *
+ * @return true Block is cached
+ * @return false Block is not cached
+ */
+static bool isCached(u16 timer0)
+{
+    auto block = SeedCache5::find(profile, timer0, date, 0);
+    if (!block)
+    {
+        return false;
+    }
+
+    auto seeds = getSeeds(timer0);
+    return std::equal(seeds.begin(), seeds.end(), block.data());
+}
+
+/**
+ * @brief Lists the files of \p directory that have the extension \p extension
+ *
+ * @param directory Cache directory
+ * @param extension File extension
+ *
+ * @return Vector of file paths
+ */
+static std::vector<std::filesystem::path> getFiles(const std::filesystem::path &directory, const std::string &extension)
+{
+    std::vector<std::filesystem::path> files;
+    for (const auto &file : std::filesystem::directory_iterator(directory))
+    {
+        if (file.path().extension() == extension)
+        {
+            files.emplace_back(file.path());
+        }
+    }
+    return files;
+}
+
+void SeedCache5Test::cleanup()
+{
+    SeedCache5::unload();
+}
+
+void SeedCache5Test::enable()
+{
+    QTemporaryDir dir;
+    std::filesystem::path directory = dir.filePath("cache").toStdString();
+
+    // A size limit below one block disables the cache
+    QVERIFY(!SeedCache5::init(directory, blockSize - 1));
+    QVERIFY(!SeedCache5::isEnabled());
+    insertBlock(0xc79);
+    QVERIFY(!isCached(0xc79));
+
+    QVERIFY(SeedCache5::init(directory, 2 * blockSize));
+    QVERIFY(SeedCache5::isEnabled());
+    QVERIFY(std::filesystem::is_directory(directory));
+    QVERIFY(!isCached(0xc79));
+
+    SeedCache5::unload();
+    QVERIFY(!SeedCache5::isEnabled());
+    insertBlock(0xc79);
+    QVERIFY(getFiles(directory, ".seeds").empty());
+}
+
+void SeedCache5Test::insert()
+{
+    QTemporaryDir dir;
+    std::filesystem::path directory = dir.path().toStdString();
+    QVERIFY(SeedCache5::init(directory, 2 * blockSize));
+
+    insertBlock(0xc79);
+    QVERIFY(isCached(0xc79));
+    QVERIFY(!isCached(0xc7a));
+    QVERIFY(!SeedCache5::find(profile, 0xc79, Date(2024, 1, 2), 0));
+    QVERIFY(!SeedCache5::find(profile, 0xc79, date, 1));
+
+    auto files = getFiles(directory, ".seeds");
+    QCOMPARE(files.size(), static_cast<size_t>(1));
+    QCOMPARE(static_cast<u64>(std::filesystem::file_size(files.front())), blockSize);
+
+    // Inserting a cached block again keeps a single file
+    insertBlock(0xc79);
+    QVERIFY(isCached(0xc79));
+    QCOMPARE(getFiles(directory, ".seeds").size(), static_cast<size_t>(1));
+}
+
+void SeedCache5Test::evict()
+{
+    QTemporaryDir dir;
+    std::filesystem::path directory = dir.path().toStdString();
+    QVERIFY(SeedCache5::init(directory, 2 * blockSize));
+
+    insertBlock(0xc79);
+    insertBlock(0xc7a);
+
+    // Using the first block makes the second one the least recently used
+    QVERIFY(isCached(0xc79));
+    insertBlock(0xc7b);
+
+    QVERIFY(isCached(0xc79));
+    QVERIFY(!isCached(0xc7a));
+    QVERIFY(isCached(0xc7b));
+    QCOMPARE(getFiles(directory, ".seeds").size(), static_cast<size_t>(2));
+}
+
+void SeedCache5Test::restart()
+{
+    QTemporaryDir dir;
+    std::filesystem::path directory = dir.path().toStdString();
+    QVERIFY(SeedCache5::init(directory, 2 * blockSize));
+
+    insertBlock(0xc79);
+    auto first = getFiles(directory, ".seeds").front();
+    insertBlock(0xc7a);
+    std::filesystem::path second;
+    for (const auto &file : getFiles(directory, ".seeds"))
+    {
+        if (file != first)
+        {
+            second = file;
+        }
+    }
+
+    // The usage order is restored from the modification times, so make the first block the most recently used
+    auto now = std::filesystem::file_time_type::clock::now();
+    std::filesystem::last_write_time(first, now);
+    std::filesystem::last_write_time(second, now - std::chrono::hours(1));
+
+    SeedCache5::unload();
+    QVERIFY(SeedCache5::init(directory, 2 * blockSize));
+    insertBlock(0xc7b);
+    QVERIFY(std::filesystem::exists(first));
+    QVERIFY(!std::filesystem::exists(second));
+    QVERIFY(isCached(0xc79));
+    QVERIFY(!isCached(0xc7a));
+    QVERIFY(isCached(0xc7b));
+
+    // Shrinking the cache evicts the least recently used blocks right away
+    std::filesystem::last_write_time(first, now - std::chrono::hours(1));
+    SeedCache5::unload();
+    QVERIFY(SeedCache5::init(directory, blockSize));
+    QVERIFY(!std::filesystem::exists(first));
+    QCOMPARE(getFiles(directory, ".seeds").size(), static_cast<size_t>(1));
+    QVERIFY(isCached(0xc7b));
+}
+
+void SeedCache5Test::keyMismatch()
+{
+    QTemporaryDir dir;
+    std::filesystem::path directory = dir.path().toStdString();
+    QVERIFY(SeedCache5::init(directory, 2 * blockSize));
+
+    insertBlock(0xc79);
+    auto first = getFiles(directory, ".seeds").front();
+    insertBlock(0xc7a);
+    std::filesystem::path second;
+    for (const auto &file : getFiles(directory, ".seeds"))
+    {
+        if (file != first)
+        {
+            second = file;
+        }
+    }
+
+    // A block whose header does not match the key of its file name is never returned
+    std::filesystem::copy_file(second, first, std::filesystem::copy_options::overwrite_existing);
+    QVERIFY(!SeedCache5::find(profile, 0xc79, date, 0));
+    QVERIFY(isCached(0xc7a));
+
+    // Files without the size of a block are ignored
+    std::filesystem::resize_file(second, blockSize - 8);
+    SeedCache5::unload();
+    QVERIFY(SeedCache5::init(directory, 2 * blockSize));
+    QVERIFY(!isCached(0xc79));
+    QVERIFY(!isCached(0xc7a));
+}
+
+void SeedCache5Test::temporary()
+{
+    QTemporaryDir dir;
+    std::filesystem::path directory = dir.path().toStdString();
+    QVERIFY(SeedCache5::init(directory, 2 * blockSize));
+
+    insertBlock(0xc79);
+    auto path = getFiles(directory, ".seeds").front();
+    auto temp = path;
+    temp += ".tmp";
+    SeedCache5::unload();
+
+    // A partially written block left by an interrupted insert is not loaded
+    std::filesystem::rename(path, temp);
+    std::filesystem::resize_file(temp, blockSize / 2);
+    QVERIFY(SeedCache5::init(directory, 2 * blockSize));
+    QVERIFY(!isCached(0xc79));
+
+    // Inserting the block again replaces the temporary file
+    insertBlock(0xc79);
+    QVERIFY(isCached(0xc79));
+    QVERIFY(!std::filesystem::exists(temp));
+    QVERIFY(getFiles(directory, ".tmp").empty());
+}
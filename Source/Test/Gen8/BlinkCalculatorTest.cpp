@@ -0,0 +1,94 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "BlinkCalculatorTest.hpp"
+#include <Core/Gen8/Tools/BlinkCalculator.hpp>
+#include <algorithm>
+#include <QTest>
+#include <Test/Data.hpp>
+
+void BlinkCalculatorTest::recoverState_data()
+{
+    QTest::addColumn<std::vector<u8>>("blinks");
+    QTest::addColumn<std::vector<u32>>("intervals");
+    QTest::addColumn<u8>("npc");
+    QTest::addColumn<std::vector<u64>>("result");
+
+    json data = readData("blink", "recoverstate");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["blinks"].get<std::vector<u8>>() << d["intervals"].get<std::vector<u32>>()
+                                                           << d["npc"].get<u8>() << d["result"].get<std::vector<u64>>();
+    }
+}
+
+void BlinkCalculatorTest::recoverState()
+{
+    QFETCH(std::vector<u8>, blinks);
+    QFETCH(std::vector<u32>, intervals);
+    QFETCH(u8, npc);
+    QFETCH(std::vector<u64>, result);
+
+    auto states = BlinkCalculator::recoverState(blinks, intervals, npc);
+    QVERIFY(states.size() == 1);
+    QCOMPARE(states[0][0], result[0]);
+    QCOMPARE(states[0][1], result[1]);
+}
+
+void BlinkCalculatorTest::reidentifyState_data()
+{
+    QTest::addColumn<u64>("seed0");
+    QTest::addColumn<u64>("seed1");
+    QTest::addColumn<std::vector<u8>>("blinks");
+    QTest::addColumn<std::vector<u32>>("intervals");
+    QTest::addColumn<u8>("npc");
+    QTest::addColumn<u32>("maxAdvances");
+    QTest::addColumn<u32>("result");
+
+    json data = readData("blink", "reidentifystate");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["seed0"].get<u64>() << d["seed1"].get<u64>() << d["blinks"].get<std::vector<u8>>()
+            << d["intervals"].get<std::vector<u32>>() << d["npc"].get<u8>() << d["maxAdvances"].get<u32>() << d["result"].get<u32>();
+    }
+}
+
+void BlinkCalculatorTest::reidentifyState()
+{
+    QFETCH(u64, seed0);
+    QFETCH(u64, seed1);
+    QFETCH(std::vector<u8>, blinks);
+    QFETCH(std::vector<u32>, intervals);
+    QFETCH(u8, npc);
+    QFETCH(u32, maxAdvances);
+    QFETCH(u32, result);
+
+    auto advances = BlinkCalculator::reidentifyState(seed0, seed1, blinks, intervals, npc, maxAdvances);
+    QVERIFY(std::find(advances.begin(), advances.end(), result) != advances.end());
+}
+
+void BlinkCalculatorTest::zeroInterval()
+{
+    std::vector<u8> blinks = { 0, 1, 0 };
+    std::vector<u32> intervals = { 12, 0 };
+
+    QVERIFY(BlinkCalculator::recoverState(blinks, intervals, 0).empty());
+    QVERIFY(BlinkCalculator::reidentifyState(0x1234567890abcdef, 0xfedcba0987654321, blinks, intervals, 0, 100).empty());
+}
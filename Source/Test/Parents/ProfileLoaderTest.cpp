@@ -0,0 +1,148 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "ProfileLoaderTest.hpp"
+#include <Core/Enum/Game.hpp>
+#include <Core/Gen3/Profile3.hpp>
+#include <Core/Parents/ProfileLoader.hpp>
+#include <QTemporaryDir>
+#include <QTest>
+#include <filesystem>
+#include <fstream>
+#include <json.hpp>
+
+using json = nlohmann::json;
+
+/**
+ * @brief Reads the Gen 3 profiles that are currently written to \p path
+ *
+ * @param path Profiles file
+ *
+ * @return JSON array of profiles, or null if the file has none
+ */
+static json readProfiles(const std::filesystem::path &path)
+{
+    std::ifstream read(path);
+    json j = json::parse(read, nullptr, false);
+    return j.is_object() && j.contains("gen3") ? j["gen3"] : json();
+}
+
+/**
+ * @brief Creates a profile that is unique to \p tid
+ *
+ * @param tid Trainer ID
+ *
+ * @return Profile
+ */
+static Profile3 getProfile(u16 tid)
+{
+    return Profile3("-", Game::Emerald, tid, 54321, false);
+}
+
+void ProfileLoaderTest::writeBehind()
+{
+    QTemporaryDir dir;
+    std::filesystem::path path = dir.filePath("profiles.json").toStdString();
+    QVERIFY(!ProfileLoader::init(path.wstring()));
+    QVERIFY(std::filesystem::exists(path));
+
+    for (u16 tid = 0; tid < 10; tid++)
+    {
+        ProfileLoader3::addProfile(getProfile(tid));
+    }
+
+    // Modifications are visible right away but only written once they stop coming in
+    QCOMPARE(ProfileLoader3::getProfiles().size(), static_cast<size_t>(10));
+    QVERIFY(readProfiles(path).is_null());
+
+    QTRY_VERIFY_WITH_TIMEOUT(readProfiles(path).size() == 10, 5000);
+    QVERIFY(!std::filesystem::exists(path.string() + ".tmp"));
+
+    auto profiles = ProfileLoader3::getProfiles();
+    for (u16 tid = 0; tid < 10; tid++)
+    {
+        QVERIFY(profiles[tid] == getProfile(tid));
+    }
+}
+
+void ProfileLoaderTest::flush()
+{
+    QTemporaryDir dir;
+    std::filesystem::path path = dir.filePath("profiles.json").toStdString();
+    QVERIFY(!ProfileLoader::init(path.wstring()));
+
+    ProfileLoader3::addProfile(getProfile(12345));
+    ProfileLoader::flush();
+
+    json profiles = readProfiles(path);
+    QCOMPARE(profiles.size(), static_cast<size_t>(1));
+    QCOMPARE(profiles[0]["tid"].get<u16>(), static_cast<u16>(12345));
+    QVERIFY(!std::filesystem::exists(path.string() + ".tmp"));
+
+    // Without pending modifications the file is left alone
+    std::ofstream(path) << "{}";
+    ProfileLoader::flush();
+    QVERIFY(readProfiles(path).is_null());
+}
+
+void ProfileLoaderTest::modify()
+{
+    QTemporaryDir dir;
+    std::filesystem::path path = dir.filePath("profiles.json").toStdString();
+    QVERIFY(!ProfileLoader::init(path.wstring()));
+
+    ProfileLoader3::addProfile(getProfile(1));
+    ProfileLoader3::addProfile(getProfile(2));
+    ProfileLoader3::updateProfile(getProfile(3), getProfile(1));
+    ProfileLoader3::removeProfile(getProfile(2));
+
+    // Removing a profile that is not stored changes nothing
+    ProfileLoader3::removeProfile(getProfile(4));
+
+    auto profiles = ProfileLoader3::getProfiles();
+    QCOMPARE(profiles.size(), static_cast<size_t>(1));
+    QVERIFY(profiles[0] == getProfile(3));
+
+    ProfileLoader::flush();
+    QCOMPARE(readProfiles(path).size(), static_cast<size_t>(1));
+    QCOMPARE(readProfiles(path)[0]["tid"].get<u16>(), static_cast<u16>(3));
+}
+
+void ProfileLoaderTest::switchFile()
+{
+    QTemporaryDir dir;
+    std::filesystem::path first = dir.filePath("first.json").toStdString();
+    std::filesystem::path second = dir.filePath("second.json").toStdString();
+    QVERIFY(!ProfileLoader::init(first.wstring()));
+
+    // Switching files writes the pending modifications of the current one first
+    ProfileLoader3::addProfile(getProfile(1));
+    QVERIFY(!ProfileLoader::init(second.wstring()));
+    QCOMPARE(readProfiles(first).size(), static_cast<size_t>(1));
+    QVERIFY(ProfileLoader3::getProfiles().empty());
+
+    ProfileLoader3::addProfile(getProfile(2));
+    QVERIFY(ProfileLoader::init(first.wstring()));
+    QCOMPARE(readProfiles(second).size(), static_cast<size_t>(1));
+    QCOMPARE(readProfiles(second)[0]["tid"].get<u16>(), static_cast<u16>(2));
+
+    auto profiles = ProfileLoader3::getProfiles();
+    QCOMPARE(profiles.size(), static_cast<size_t>(1));
+    QVERIFY(profiles[0] == getProfile(1));
+}
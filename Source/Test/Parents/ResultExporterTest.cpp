@@ -0,0 +1,214 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "ResultExporterTest.hpp"
+#include <Core/Gen4/Searchers/IDSearcher4.hpp>
+#include <Core/Gen4/States/IDState4.hpp>
+#include <Core/Parents/Filters/IDFilter.hpp>
+#include <Core/Parents/Searchers/ResultExporter.hpp>
+#include <QTemporaryDir>
+#include <QTest>
+#include <fstream>
+#include <sstream>
+
+using Row = std::array<u64, 4>;
+
+/**
+ * @brief Columns of the exported TID/SID states
+ *
+ * @return Vector of columns
+ */
+static std::vector<ResultColumn<IDState4>> getColumns()
+{
+    return { { "seed", 4, [](const IDState4 &state) { return state.getSeed(); } },
+             { "delay", 4, [](const IDState4 &state) { return state.getDelay(); } },
+             { "tid", 2, [](const IDState4 &state) { return state.getTID(); } },
+             { "sid", 2, [](const IDState4 &state) { return state.getSID(); } } };
+}
+
+/**
+ * @brief Searches the delays without exporting to get the rows an export has to produce
+ *
+ * @return Vector of rows
+ */
+static std::vector<Row> getExpected()
+{
+    IDSearcher4 searcher(IDFilter({}, {}, {}, {}));
+    searcher.startSearch(false, 2000, 5000, 5001);
+
+    std::vector<Row> rows;
+    for (const auto &state : searcher.getResults())
+    {
+        rows.push_back({ state.getSeed(), state.getDelay(), state.getTID(), state.getSID() });
+    }
+    return rows;
+}
+
+/**
+ * @brief Searches the delays while exporting the results. The small result limit makes the search wait on the writer.
+ *
+ * @param path File to export to
+ * @param format Export format
+ *
+ * @return Number of exported results
+ */
+static u64 exportSearch(const std::string &path, ExportFormat format)
+{
+    IDSearcher4 searcher(IDFilter({}, {}, {}, {}));
+    ResultExporter<IDState4> exporter(searcher, getColumns(), format, 16);
+    if (!exporter.start(path))
+    {
+        return 0;
+    }
+
+    searcher.startSearch(false, 2000, 5000, 5001);
+    exporter.finish();
+    return exporter.getCount();
+}
+
+void ResultExporterTest::exportBinary()
+{
+    QTemporaryDir dir;
+    std::string path = dir.filePath("results.bin").toStdString();
+
+    auto expected = getExpected();
+    QVERIFY(!expected.empty());
+    QCOMPARE(exportSearch(path, ExportFormat::Binary), expected.size());
+
+    std::ifstream file(path, std::ios::binary);
+    u32 header[3];
+    file.read(reinterpret_cast<char *>(header), sizeof(header));
+    QCOMPARE(header[0], 0x43524650u);
+    QCOMPARE(header[1], 1u);
+    QCOMPARE(header[2], 4u);
+
+    std::vector<u8> sizes;
+    for (const auto &column : getColumns())
+    {
+        u8 size = file.get();
+        u8 length = file.get();
+        std::string name(length, '\0');
+        file.read(name.data(), length);
+        QCOMPARE(size, column.size);
+        QCOMPARE(name, column.name);
+        sizes.emplace_back(size);
+    }
+
+    // Blocks store the row count followed by every column contiguously
+    std::vector<Row> rows;
+    u32 count;
+    while (file.read(reinterpret_cast<char *>(&count), sizeof(count)))
+    {
+        size_t offset = rows.size();
+        rows.resize(offset + count);
+        for (size_t column = 0; column < sizes.size(); column++)
+        {
+            for (u32 i = 0; i < count; i++)
+            {
+                u64 value = 0;
+                file.read(reinterpret_cast<char *>(&value), sizes[column]);
+                rows[offset + i][column] = value;
+            }
+        }
+    }
+
+    QVERIFY(rows == expected);
+}
+
+void ResultExporterTest::exportCSV()
+{
+    QTemporaryDir dir;
+    std::string path = dir.filePath("results.csv").toStdString();
+
+    auto expected = getExpected();
+    QVERIFY(!expected.empty());
+    QCOMPARE(exportSearch(path, ExportFormat::CSV), expected.size());
+
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    QCOMPARE(line, std::string("seed,delay,tid,sid"));
+
+    std::vector<Row> rows;
+    while (std::getline(file, line))
+    {
+        std::stringstream stream(line);
+        Row row;
+        char comma;
+        stream >> row[0] >> comma >> row[1] >> comma >> row[2] >> comma >> row[3];
+        rows.emplace_back(row);
+    }
+
+    QVERIFY(rows == expected);
+}
+
+void ResultExporterTest::exportConvert()
+{
+    QTemporaryDir dir;
+    std::string path = dir.filePath("results.csv").toStdString();
+
+    // Rows with an odd TID can not be converted and are skipped
+    std::vector<Row> expected;
+    for (const auto &row : getExpected())
+    {
+        if ((row[2] & 1) == 0)
+        {
+            expected.emplace_back(row);
+        }
+    }
+
+    std::vector<ResultColumn<Row>> columns;
+    for (size_t i = 0; i < 4; i++)
+    {
+        columns.push_back({ std::to_string(i), 4, [i](const Row &row) { return row[i]; } });
+    }
+
+    IDSearcher4 searcher(IDFilter({}, {}, {}, {}));
+    ResultExporter<IDState4, Row> exporter(searcher, columns, ExportFormat::CSV, 16, [](const IDState4 &state) -> std::optional<Row> {
+        if (state.getTID() & 1)
+        {
+            return std::nullopt;
+        }
+        return Row { state.getSeed(), state.getDelay(), state.getTID(), state.getSID() };
+    });
+    QVERIFY(exporter.start(path));
+    searcher.startSearch(false, 2000, 5000, 5001);
+    exporter.finish();
+
+    QVERIFY(exporter.getSkipped() != 0);
+    QCOMPARE(exporter.getCount(), expected.size());
+    QCOMPARE(exporter.getCount() + exporter.getSkipped(), getExpected().size());
+
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    QCOMPARE(line, std::string("0,1,2,3"));
+
+    std::vector<Row> rows;
+    while (std::getline(file, line))
+    {
+        std::stringstream stream(line);
+        Row row;
+        char comma;
+        stream >> row[0] >> comma >> row[1] >> comma >> row[2] >> comma >> row[3];
+        rows.emplace_back(row);
+    }
+
+    QVERIFY(rows == expected);
+}
@@ -0,0 +1,74 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IVSeedTableTest.hpp"
+#include <Core/RNG/IVSeedTable.hpp>
+#include <Core/RNG/LCRNGReverse.hpp>
+#include <QTest>
+#include <Test/Data.hpp>
+#include <Test/Enum.hpp>
+#include <algorithm>
+
+using IVs = std::array<u8, 5>;
+
+void IVSeedTableTest::recover_data()
+{
+    QTest::addColumn<Method>("method");
+    QTest::addColumn<IVs>("ivs");
+    QTest::addColumn<u8>("minSpe");
+    QTest::addColumn<u8>("maxSpe");
+
+    json data = readData("ivseedtable", "recover");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["method"].get<Method>() << d["ivs"].get<IVs>() << d["minSpe"].get<u8>() << d["maxSpe"].get<u8>();
+    }
+}
+
+void IVSeedTableTest::recover()
+{
+    QFETCH(Method, method);
+    QFETCH(IVs, ivs);
+    QFETCH(u8, minSpe);
+    QFETCH(u8, maxSpe);
+
+    std::vector<u32> block(0x10000);
+    IVSeedTable::buildBlock(ivs[0], ivs[1], ivs[2], block.data(), method);
+
+    u32 seeds[6 * 32];
+    int offsets[33];
+    int size = IVSeedTable::recover(block.data(), ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], minSpe, maxSpe, seeds, offsets);
+    QCOMPARE(offsets[maxSpe - minSpe + 1], size);
+
+    int total = 0;
+    for (u8 spe = minSpe; spe <= maxSpe; spe++)
+    {
+        u32 results[6];
+        int count = LCRNGReverse::recoverPokeRNGIV(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], spe, results, method);
+        total += count;
+
+        std::vector<u32> expected(results, results + count);
+        std::vector<u32> actual(seeds + offsets[spe - minSpe], seeds + offsets[spe - minSpe + 1]);
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        QCOMPARE(actual, expected);
+    }
+    QCOMPARE(size, total);
+}
@@ -19,8 +19,11 @@
 
 #include "MTTest.hpp"
 #include <Core/RNG/MT.hpp>
+#include <Core/RNG/MTKernels.hpp>
+#include <Core/Util/CPU.hpp>
 #include <QTest>
 #include <Test/Data.hpp>
+#include <random>
 
 void MTTest::advance_data()
 {
@@ -66,3 +69,56 @@ void MTTest::next()
     MT rng(seed);
     QCOMPARE(rng.next(), result);
 }
+
+void MTTest::shuffle_data()
+{
+    QTest::addColumn<u8>("level");
+    QTest::addColumn<u32>("seed");
+
+    json data = readData("mt", "shuffle");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["level"].get<u8>() << d["seed"].get<u32>();
+    }
+}
+
+void MTTest::shuffle()
+{
+    QFETCH(u8, level);
+    QFETCH(u32, seed);
+
+#ifdef SIMD_X86
+    if (static_cast<u8>(CPU::getLevel()) < level)
+    {
+        QSKIP("Kernel is not supported by this CPU");
+    }
+
+    // The kernels are run directly since MT only uses the widest one the CPU supports
+    auto *kernel = level == static_cast<u8>(CPULevel::V4) ? MTKernels::shuffleAVX512 : MTKernels::shuffleAVX2;
+
+    // Padding covers the reads past the end of the states
+    alignas(64) std::array<u32, 640> state {};
+    state[0] = seed;
+    for (u32 i = 1; i < 624; i++)
+    {
+        state[i] = 0x6c078965 * (state[i - 1] ^ (state[i - 1] >> 30)) + i;
+    }
+
+    std::mt19937 mt(seed);
+    for (int round = 0; round < 3; round++)
+    {
+        kernel(state.data());
+        for (u32 i = 0; i < 624; i++)
+        {
+            u32 y = state[i];
+            y ^= (y >> 11);
+            y ^= (y << 7) & 0x9d2c5680;
+            y ^= (y << 15) & 0xefc60000;
+            y ^= (y >> 18);
+            QCOMPARE(y, static_cast<u32>(mt()));
+        }
+    }
+#else
+    QSKIP("Kernels are only built for x86");
+#endif
+}
@@ -31,6 +31,9 @@ private slots:
 
     void next_data();
     void next();
+
+    void shuffle_data();
+    void shuffle();
 };
 
 #endif // MTTEST_HPP
@@ -0,0 +1,216 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "RadixSortTest.hpp"
+#include <Core/Util/RadixSort.hpp>
+#include <QTest>
+#include <Test/Data.hpp>
+#include <limits>
+#include <random>
+
+/**
+ * @brief Signed enum so that enum keys also cover negative values
+ */
+enum class Kind : s8
+{
+    Low = -2,
+    Middle = 0,
+    High = 2
+};
+
+/**
+ * @brief Element sorted by several key types, the index records the original position to check stability
+ */
+struct Element
+{
+    s32 value;
+    bool flag;
+    Kind kind;
+    double weight;
+    u32 index;
+};
+
+/**
+ * @brief Creates elements with many equal keys
+ *
+ * @param size Number of elements
+ *
+ * @return Vector of elements
+ */
+static std::vector<Element> getElements(u32 size)
+{
+    std::mt19937 rng(size);
+    std::uniform_int_distribution<s32> value(-500, 500);
+    constexpr Kind kinds[3] = { Kind::Low, Kind::Middle, Kind::High };
+
+    std::vector<Element> elements;
+    for (u32 i = 0; i < size; i++)
+    {
+        elements.push_back({ value(rng), (rng() & 1) != 0, kinds[rng() % 3], static_cast<double>(value(rng)) / 8, i });
+    }
+
+    // Extreme values check that the sign bit is ordered correctly
+    elements[0].value = std::numeric_limits<s32>::min();
+    elements[1].value = std::numeric_limits<s32>::max();
+    return elements;
+}
+
+/**
+ * @brief Checks if sorting by \p key gives the same order as std::stable_sort
+ *
+ * @param elements Elements to sort
+ * @param ascending Whether to sort in ascending or descending order
+ * @param threads Number of threads
+ * @param key Key function
+ *
+ * @return true Orders match
+ * @return false Orders differ
+ */
+template <class Key>
+static bool isStableSorted(const std::vector<Element> &elements, bool ascending, int threads, Key key)
+{
+    auto sorted = elements;
+    RadixSort::sortBy(sorted, ascending, key, threads);
+
+    auto expected = elements;
+    std::stable_sort(expected.begin(), expected.end(), [ascending, &key](const Element &left, const Element &right) {
+        return ascending ? key(left) < key(right) : key(right) < key(left);
+    });
+
+    return std::equal(sorted.begin(), sorted.end(), expected.begin(), expected.end(),
+                      [](const Element &left, const Element &right) { return left.index == right.index; });
+}
+
+void RadixSortTest::sort_data()
+{
+    QTest::addColumn<u32>("size");
+    QTest::addColumn<int>("threads");
+    QTest::addColumn<u32>("mask");
+    QTest::addColumn<u32>("fixed");
+
+    json data = readData("radixsort", "sort");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["size"].get<u32>() << d["threads"].get<int>() << d["mask"].get<u32>() << d["fixed"].get<u32>();
+    }
+}
+
+void RadixSortTest::sort()
+{
+    QFETCH(u32, size);
+    QFETCH(int, threads);
+    QFETCH(u32, mask);
+    QFETCH(u32, fixed);
+
+    // Digits outside of the mask are the same for every value, so their passes are skipped
+    std::mt19937 rng(size);
+    std::vector<u32> data(size);
+    for (u32 &value : data)
+    {
+        value = (rng() & mask) | fixed;
+    }
+
+    auto expected = data;
+    std::sort(expected.begin(), expected.end());
+
+    RadixSort::sort(data, threads);
+    QVERIFY(data == expected);
+
+    // 64-bit values whose upper half is only used by some of them
+    std::vector<u64> wide(size);
+    for (u64 &value : wide)
+    {
+        value = (static_cast<u64>(rng() & mask & 0xf) << 40) | (rng() & mask) | fixed;
+    }
+
+    auto wideExpected = wide;
+    std::sort(wideExpected.begin(), wideExpected.end());
+
+    RadixSort::sort(wide, threads);
+    QVERIFY(wide == wideExpected);
+}
+
+void RadixSortTest::sortBy_data()
+{
+    QTest::addColumn<u32>("size");
+    QTest::addColumn<int>("threads");
+    QTest::addColumn<bool>("ascending");
+
+    json data = readData("radixsort", "sortBy");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["size"].get<u32>() << d["threads"].get<int>() << d["ascending"].get<bool>();
+    }
+}
+
+void RadixSortTest::sortBy()
+{
+    QFETCH(u32, size);
+    QFETCH(int, threads);
+    QFETCH(bool, ascending);
+
+    auto elements = getElements(size);
+
+    QVERIFY(isStableSorted(elements, ascending, threads, [](const Element &element) { return element.value; }));
+    QVERIFY(isStableSorted(elements, ascending, threads, [](const Element &element) { return static_cast<s64>(element.value) * 3; }));
+    QVERIFY(isStableSorted(elements, ascending, threads, [](const Element &element) { return static_cast<s8>(element.value); }));
+    QVERIFY(isStableSorted(elements, ascending, threads, [](const Element &element) { return static_cast<u16>(element.value); }));
+    QVERIFY(isStableSorted(elements, ascending, threads, [](const Element &element) { return element.flag; }));
+    QVERIFY(isStableSorted(elements, ascending, threads, [](const Element &element) { return element.kind; }));
+
+    // Keys that are not integers use std::stable_sort
+    QVERIFY(isStableSorted(elements, ascending, threads, [](const Element &element) { return element.weight; }));
+}
+
+void RadixSortTest::sortUnique_data()
+{
+    QTest::addColumn<u32>("size");
+    QTest::addColumn<int>("threads");
+    QTest::addColumn<u32>("run");
+
+    json data = readData("radixsort", "sortUnique");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["size"].get<u32>() << d["threads"].get<int>() << d["run"].get<u32>();
+    }
+}
+
+void RadixSortTest::sortUnique()
+{
+    QFETCH(u32, size);
+    QFETCH(int, threads);
+    QFETCH(u32, run);
+
+    // Runs of equal values whose length does not divide the chunk sizes, so runs cross the chunk boundaries once sorted
+    std::vector<u32> data(size);
+    for (u32 i = 0; i < size; i++)
+    {
+        data[i] = (i / run) * 0x9e3779b1;
+    }
+    std::shuffle(data.begin(), data.end(), std::mt19937(size));
+
+    auto expected = data;
+    std::sort(expected.begin(), expected.end());
+    expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+    RadixSort::sortUnique(data, threads);
+    QVERIFY(data == expected);
+}
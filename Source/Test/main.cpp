@@ -19,6 +19,7 @@
 
 #include <QDebug>
 #include <QTest>
+#include <Test/Cli/JobsTest.hpp>
 #include <Test/Gen3/EggGenerator3Test.hpp>
 #include <Test/Gen3/GameCubeGeneratorTest.hpp>
 #include <Test/Gen3/GameCubeSearcherTest.hpp>
@@ -46,6 +47,9 @@
 #include <Test/Gen5/HiddenGrottoGeneratorTest.hpp>
 #include <Test/Gen5/IDGenerator5Test.hpp>
 #include <Test/Gen5/ProfileSearcher5Test.hpp>
+#include <Test/Gen5/Searcher5Test.hpp>
+#include <Test/Gen5/SeedCache5Test.hpp>
+#include <Test/Gen8/BlinkCalculatorTest.hpp>
 #include <Test/Gen8/EggGenerator8Test.hpp>
 #include <Test/Gen8/EventGenerator8Test.hpp>
 #include <Test/Gen8/IDGenerator8Test.hpp>
@@ -53,6 +57,9 @@
 #include <Test/Gen8/StaticGenerator8Test.hpp>
 #include <Test/Gen8/UndergroundGeneratorTest.hpp>
 #include <Test/Gen8/WildGenerator8Test.hpp>
+#include <Test/Parents/ProfileLoaderTest.hpp>
+#include <Test/Parents/ResultExporterTest.hpp>
+#include <Test/RNG/IVSeedTableTest.hpp>
 #include <Test/RNG/LCRNG64Test.hpp>
 #include <Test/RNG/LCRNGReverseTest.hpp>
 #include <Test/RNG/LCRNGTest.hpp>
@@ -66,6 +73,7 @@
 #include <Test/Util/EncounterSlotTest.hpp>
 #include <Test/Util/IVCheckerTest.hpp>
 #include <Test/Util/IVToPIDCalculatorTest.hpp>
+#include <Test/Util/RadixSortTest.hpp>
 
 template <class Testname>
 int runTest(QStringList &fails)
@@ -86,6 +94,9 @@ int main()
     int status = 0;
     QStringList fails;
 
+    // CLI
+    status += runTest<JobsTest>(fails);
+
     // Gen 3
     status += runTest<EggGenerator3Test>(fails);
     status += runTest<GameCubeGeneratorTest>(fails);
@@ -118,8 +129,11 @@ int main()
     status += runTest<HiddenGrottoGeneratorTest>(fails);
     status += runTest<IDGenerator5Test>(fails);
     status += runTest<ProfileSearcher5Test>(fails);
+    status += runTest<Searcher5Test>(fails);
+    status += runTest<SeedCache5Test>(fails);
 
     // Gen 8
+    status += runTest<BlinkCalculatorTest>(fails);
     status += runTest<IDGenerator8Test>(fails);
     status += runTest<EggGenerator8Test>(fails);
     status += runTest<EventGenerator8Test>(fails);
@@ -128,7 +142,12 @@ int main()
     status += runTest<UndergroundGeneratorTest>(fails);
     status += runTest<WildGenerator8Test>(fails);
 
+    // Parent Tests
+    status += runTest<ProfileLoaderTest>(fails);
+    status += runTest<ResultExporterTest>(fails);
+
     // RNG Tests
+    status += runTest<IVSeedTableTest>(fails);
     status += runTest<LCRNGTest>(fails);
     status += runTest<LCRNGReverseTest>(fails);
     status += runTest<LCRNG64Test>(fails);
@@ -147,6 +166,7 @@ int main()
     status += runTest<EncounterSlotTest>(fails);
     status += runTest<IVCheckerTest>(fails);
     status += runTest<IVToPIDCalculatorTest>(fails);
+    status += runTest<RadixSortTest>(fails);
 
     qDebug() << "";
     // Summary of failures at end for easy viewing
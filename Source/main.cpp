@@ -17,7 +17,9 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <Core/Gen5/SeedCache5.hpp>
 #include <Core/Parents/ProfileLoader.hpp>
+#include <Core/RNG/IVSeedTable.hpp>
 #include <Core/Util/Translator.hpp>
 #include <Form/MainWindow.hpp>
 #include <QApplication>
@@ -94,6 +96,19 @@ int main(int argc, char *argv[])
     QString profilePath = setting.value("profiles").toString();
     bool profile = ProfileLoader::init(profilePath.toStdWString());
 
+    // Optional IV seed tables built with pokefinder-cli --build-iv-table
+    for (const QString &path : setting.value("ivTables").toStringList())
+    {
+        IVSeedTable::load(path.toStdWString());
+    }
+
+    // Optional Gen 5 seed cache, the size is in MiB
+    QString seedCache = setting.value("seedCache").toString();
+    if (!seedCache.isEmpty())
+    {
+        SeedCache5::init(seedCache.toStdWString(), setting.value("seedCacheSize", 4096).toULongLong() << 20);
+    }
+
     a.setStyle("fusion");
     if (setting.value("style").toString() == "dark")
     {
@@ -118,5 +133,7 @@ int main(int argc, char *argv[])
     MainWindow w(profile);
     w.show();
 
-    return a.exec();
+    int code = a.exec();
+    ProfileLoader::flush();
+    return code;
 }